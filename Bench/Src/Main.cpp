@@ -0,0 +1,362 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Camera2D.h"
+#include "EntityManager.h"
+#include "IApp.h"
+#include "IEntity2D.h"
+#include "NullGL.h"
+#include "RenderManager2D.h"
+#include "RenderStateManager.h"
+#include "ResourceManager.h"
+#include "StaticBatch2D.h"
+#include "System2D.h"
+#include "TextRun.h"
+#include "Texture2D.h"
+#include "TextureArray2D.h"
+#include "TTFont.h"
+#include "World.h"
+
+/** ƼƼ /ı ġũ ϴ ƼƼԴϴ. ũ Ϲ 2D ƼƼ  ϴ. */
+class BenchEntity : public IEntity2D
+{
+public:
+	BenchEntity(const Vec2f& position) : position_(position) { bIsInitialized_ = true; }
+	virtual ~BenchEntity() {}
+
+	DISALLOW_COPY_AND_ASSIGN(BenchEntity);
+
+	virtual void Tick(float deltaSeconds) override { position_.x += velocity_.x * deltaSeconds; position_.y += velocity_.y * deltaSeconds; }
+	virtual void Render() override {}
+	virtual void Release() override { bIsInitialized_ = false; }
+
+private:
+	Vec2f position_;
+	Vec2f velocity_ = Vec2f(1.0f, 1.0f);
+	Vec4f color_ = Vec4f(1.0f, 1.0f, 1.0f, 1.0f);
+};
+
+/**
+ * NullGL 鿣  RenderManager2D CPU   ϴ ġũԴϴ.
+ *  ġ MiniGame 丮  丮 մϴ. (̴ ΰ MiniGame/Shader/... ̱ )
+ *
+ * Ʈ θ ϸ  ۸ ĳ Ʈ Ӹ  ѱ ۸ ȭϰ   뵵 մϴ.
+ *
+ * ƼƼ ũε Ӹ ƼƼ 50,000 , Tick, ıϴ  մϴ.
+ *
+ *  Ŀ StaticBatch2D    ˻ϰ,  ˻簡  0 ƴ  մϴ.
+ *
+ * : MiniGameBench [primitive ] [ ] [TTF Ʈ ]
+ */
+class BenchApp : public IApp
+{
+public:
+	struct Workload
+	{
+		std::string name;
+		std::function<void(uint32_t)> draw; /** ڴ ̹ ӿ ׸  ε  ũԴϴ. */
+	};
+
+public:
+	BenchApp(uint32_t primitiveCount, uint32_t frameCount, const std::string& fontPath)
+		: IApp("MiniGameBench", 0, 0, 1000, 800, false, false, true)
+		, primitiveCount_(primitiveCount)
+		, frameCount_(frameCount)
+		, fontPath_(fontPath)
+	{
+	}
+
+	virtual ~BenchApp() {}
+
+	DISALLOW_COPY_AND_ASSIGN(BenchApp);
+
+	virtual void Startup() override
+	{
+		renderStateMgr_ = RenderStateManager::GetPtr();
+		render2dMgr_ = RenderManager2D::GetPtr();
+
+		camera_ = Camera2D::CreateScreenCamera();
+		texture_ = ResourceManager::GetRef().Create<Texture2D>("MiniGame/Image/Runner2D.png", Texture2D::Filter::LINEAR);
+
+		if (!fontPath_.empty())
+		{
+			font_ = ResourceManager::GetRef().Create<TTFont>(fontPath_, 0x00, 0x128, 16.0f);
+			textRun_.Set(font_, L"MiniGame");
+
+			dynamicFont_ = ResourceManager::GetRef().Create<TTFont>(fontPath_, 16.0f, DYNAMIC_ATLAS_SIZE);
+		}
+
+		instances_.resize(primitiveCount_);
+		for (uint32_t index = 0; index < primitiveCount_; ++index)
+		{
+			instances_[index].center = GetPosition(index);
+			instances_[index].size = Vec2f(16.0f, 16.0f);
+		}
+
+		world_ = EntityManager::GetRef().Create<World>();
+		world_->AddRenderSystem(System2D::RenderSprites);
+		for (uint32_t index = 0; index < primitiveCount_; ++index)
+		{
+			Transform2D transform;
+			transform.position = GetPosition(index);
+			transform.size = Vec2f(16.0f, 16.0f);
+
+			Sprite2D sprite;
+			sprite.texture = texture_;
+
+			world_->CreateEntity(transform, sprite);
+		}
+	}
+
+	virtual void Shutdown() override
+	{
+		EntityManager::GetRef().Destroy(world_);
+		world_ = nullptr;
+
+		if (font_)
+		{
+			textRun_.Set(nullptr, L"");
+			ResourceManager::GetRef().Destroy(font_);
+			font_ = nullptr;
+
+			ResourceManager::GetRef().Destroy(dynamicFont_);
+			dynamicFont_ = nullptr;
+		}
+
+		ResourceManager::GetRef().Destroy(texture_);
+		texture_ = nullptr;
+
+		EntityManager::GetRef().Destroy(camera_);
+		camera_ = nullptr;
+	}
+
+	int32_t RunBench()
+	{
+		std::vector<Workload> workloads =
+		{
+			{ "Sprite",          [&](uint32_t index) { render2dMgr_->DrawSprite(texture_, GetPosition(index), 16.0f, 16.0f, 0.0f, RenderManager2D::SpriteRenderOptions()); } },
+			{ "RoundRect",       [&](uint32_t index) { render2dMgr_->DrawRoundRect(GetPosition(index), 16.0f, 12.0f, 4.0f, Vec4f(1.0f, 0.5f, 0.0f, 1.0f), 0.0f); } },
+			{ "Circle",          [&](uint32_t index) { render2dMgr_->DrawCircle(GetPosition(index), 8.0f, Vec4f(0.0f, 0.5f, 1.0f, 1.0f)); } },
+			{ "SpriteInstanced", [&](uint32_t index) { if (index == 0) { render2dMgr_->DrawSpriteInstanced(texture_, instances_.data(), primitiveCount_); } } },
+			{ "WorldSprite",     [&](uint32_t index) { if (index == 0) { world_->Render(); } } },
+		};
+
+		if (font_)
+		{
+			workloads.push_back({ "String", [&](uint32_t index) { render2dMgr_->DrawString(font_, L"MiniGame", GetPosition(index), Vec4f(1.0f, 1.0f, 1.0f, 1.0f)); } });
+			workloads.push_back({ "TextRun", [&](uint32_t index) { render2dMgr_->DrawString(&textRun_, GetPosition(index), Vec4f(1.0f, 1.0f, 1.0f, 1.0f)); } });
+			workloads.push_back({ "DynamicString", [&](uint32_t index) { render2dMgr_->DrawString(dynamicFont_, GetDynamicText(index), GetPosition(index), Vec4f(1.0f, 1.0f, 1.0f, 1.0f)); } });
+		}
+
+		std::printf("%-16s %12s %14s %12s %14s %14s\n", "workload", "ns/primitive", "vertices/frame", "draws/frame", "upload/frame", "GL calls/frame");
+		for (const auto& workload : workloads)
+		{
+			RunWorkload(workload);
+		}
+
+		std::printf("\n%-16s %12s %12s %12s\n", "entity", "ns/create", "ns/tick", "ns/destroy");
+		RunEntityWorkload("EntityManager",
+			[&](uint32_t index) { entities_[index] = EntityManager::GetRef().Create<BenchEntity>(GetPosition(index)); },
+			[&](uint32_t index) { EntityManager::GetRef().Destroy(entities_[index]); }
+		);
+		RunEntityWorkload("make_unique",
+			[&](uint32_t index) { heapEntities_[index] = std::make_unique<BenchEntity>(GetPosition(index)); entities_[index] = heapEntities_[index].get(); },
+			[&](uint32_t index) { heapEntities_[index]->Release(); heapEntities_[index].reset(); }
+		);
+
+		std::printf("\n");
+		return CheckStaticBatch();
+	}
+
+private:
+	Vec2f GetPosition(uint32_t index) const
+	{
+		static const uint32_t COLUMN_SIZE = 50;
+		float x = -480.0f + static_cast<float>(index % COLUMN_SIZE) * 19.2f;
+		float y = -380.0f + static_cast<float>((index / COLUMN_SIZE) % 40) * 19.0f;
+		return Vec2f(x, y);
+	}
+
+	/** Ӹ ѱ  â DYNAMIC_GLYPH_STEPŭ о,    ۸ ȭϰ    մϴ. */
+	std::wstring GetDynamicText(uint32_t index)
+	{
+		static const uint32_t HANGUL_BEGIN = 0xAC00;
+		static const uint32_t HANGUL_SIZE = 11172;
+		static const uint32_t TEXT_LENGTH = 4;
+
+		if (index == 0)
+		{
+			dynamicGlyphBase_ = (dynamicGlyphBase_ + DYNAMIC_GLYPH_STEP) % HANGUL_SIZE;
+		}
+
+		std::wstring text(TEXT_LENGTH, L' ');
+		for (uint32_t offset = 0; offset < TEXT_LENGTH; ++offset)
+		{
+			uint32_t glyph = (index * TEXT_LENGTH + offset) % DYNAMIC_GLYPH_WINDOW;
+			text[offset] = static_cast<wchar_t>(HANGUL_BEGIN + (dynamicGlyphBase_ + glyph) % HANGUL_SIZE);
+		}
+
+		return text;
+	}
+
+	/**  ٸ ؽó 迭   ޾ , ̴ 0 ָ øϹǷ     մϴ. */
+	int32_t CheckStaticBatch()
+	{
+		int32_t failCount = 0;
+
+		TextureArray2D* textureArrays[2] =
+		{
+			ResourceManager::GetRef().Create<TextureArray2D>(16, 16, 1, ITexture::Filter::NEAREST),
+			ResourceManager::GetRef().Create<TextureArray2D>(16, 16, 1, ITexture::Filter::NEAREST),
+		};
+		StaticBatch2D* batch = ResourceManager::GetRef().Create<StaticBatch2D>();
+
+		batch->Begin(camera_);
+		render2dMgr_->DrawSprite(textureArrays[0], 0, GetPosition(0), 16.0f, 16.0f, 0.0f, RenderManager2D::SpriteRenderOptions());
+		render2dMgr_->DrawSprite(textureArrays[0], 0, GetPosition(1), 16.0f, 16.0f, 0.0f, RenderManager2D::SpriteRenderOptions());
+		render2dMgr_->DrawSprite(textureArrays[1], 0, GetPosition(2), 16.0f, 16.0f, 0.0f, RenderManager2D::SpriteRenderOptions());
+		batch->End();
+
+		bool bIsPassed = batch->GetSegmentCount() == 2;
+		std::printf("[%s] StaticBatch2D: two texture arrays bake into two segments (%u)\n", bIsPassed ? "PASS" : "FAIL", batch->GetSegmentCount());
+		failCount += bIsPassed ? 0 : 1;
+
+		ResourceManager::GetRef().Destroy(batch);
+		ResourceManager::GetRef().Destroy(textureArrays[1]);
+		ResourceManager::GetRef().Destroy(textureArrays[0]);
+
+		return failCount;
+	}
+
+	void RunWorkload(const Workload& workload)
+	{
+		uint64_t elapsedNanoseconds = 0;
+		uint64_t uploadByteSize = 0;
+
+		NullGL::ResetStats();
+		for (uint32_t frame = 0; frame < frameCount_; ++frame)
+		{
+			render2dMgr_->ResetStats();
+
+			auto begin = std::chrono::high_resolution_clock::now();
+			{
+				renderStateMgr_->BeginFrame(0.0f, 0.0f, 0.0f, 1.0f);
+				render2dMgr_->Begin(camera_);
+				{
+					for (uint32_t index = 0; index < primitiveCount_; ++index)
+					{
+						workload.draw(index);
+					}
+				}
+				render2dMgr_->End();
+				renderStateMgr_->EndFrame();
+			}
+			auto end = std::chrono::high_resolution_clock::now();
+
+			elapsedNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+			uploadByteSize += render2dMgr_->GetStats().uploadByteSize;
+		}
+
+		const NullGL::Stats& stats = NullGL::GetStats();
+		double frames = static_cast<double>(frameCount_);
+		double primitives = frames * static_cast<double>(primitiveCount_);
+
+		std::printf("%-16s %12.2f %14.0f %12.2f %14.0f %14.2f\n",
+			workload.name.c_str(),
+			static_cast<double>(elapsedNanoseconds) / primitives,
+			static_cast<double>(stats.vertexCount) / frames,
+			static_cast<double>(stats.drawCallCount) / frames,
+			static_cast<double>(uploadByteSize + stats.textureUploadByteSize) / frames,
+			static_cast<double>(stats.callCount) / frames
+		);
+	}
+
+	void RunEntityWorkload(const char* name, const std::function<void(uint32_t)>& create, const std::function<void(uint32_t)>& destroy)
+	{
+		static const uint32_t ENTITY_COUNT = 50000;
+
+		entities_.resize(ENTITY_COUNT);
+		heapEntities_.resize(ENTITY_COUNT);
+
+		uint64_t createNanoseconds = 0;
+		uint64_t tickNanoseconds = 0;
+		uint64_t destroyNanoseconds = 0;
+
+		for (uint32_t frame = 0; frame < frameCount_; ++frame)
+		{
+			auto begin = std::chrono::high_resolution_clock::now();
+			for (uint32_t index = 0; index < ENTITY_COUNT; ++index)
+			{
+				create(index);
+			}
+			auto created = std::chrono::high_resolution_clock::now();
+			for (uint32_t index = 0; index < ENTITY_COUNT; ++index)
+			{
+				entities_[index]->Tick(1.0f / 60.0f);
+			}
+			auto ticked = std::chrono::high_resolution_clock::now();
+			for (uint32_t index = 0; index < ENTITY_COUNT; ++index)
+			{
+				destroy(index);
+			}
+			auto end = std::chrono::high_resolution_clock::now();
+
+			createNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(created - begin).count();
+			tickNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(ticked - created).count();
+			destroyNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(end - ticked).count();
+		}
+
+		double entities = static_cast<double>(frameCount_) * static_cast<double>(ENTITY_COUNT);
+		std::printf("%-16s %12.2f %12.2f %12.2f\n",
+			name,
+			static_cast<double>(createNanoseconds) / entities,
+			static_cast<double>(tickNanoseconds) / entities,
+			static_cast<double>(destroyNanoseconds) / entities
+		);
+	}
+
+private:
+	static constexpr int32_t DYNAMIC_ATLAS_SIZE = 256; /**  Ʋ󽺷  Ⱑ  Ͼ մϴ. */
+	static const uint32_t DYNAMIC_GLYPH_WINDOW = 64; /**  ӿ ׸  ٸ ۸ Դϴ. Ʋ 뷮 ۾ƾ մϴ. */
+	static const uint32_t DYNAMIC_GLYPH_STEP = 16; /** Ӹ  ȭ ۸ Դϴ. */
+
+	uint32_t primitiveCount_ = 0;
+	uint32_t frameCount_ = 0;
+	std::string fontPath_;
+
+	RenderStateManager* renderStateMgr_ = nullptr;
+	RenderManager2D* render2dMgr_ = nullptr;
+
+	Camera2D* camera_ = nullptr;
+	Texture2D* texture_ = nullptr;
+	TTFont* font_ = nullptr;
+	TTFont* dynamicFont_ = nullptr;
+	uint32_t dynamicGlyphBase_ = 0;
+	TextRun textRun_;
+	World* world_ = nullptr;
+
+	std::vector<RenderManager2D::SpriteInstance> instances_;
+
+	std::vector<IEntity*> entities_;
+	std::vector<std::unique_ptr<BenchEntity>> heapEntities_;
+};
+
+int main(int argc, char* argv[])
+{
+	uint32_t primitiveCount = (argc > 1) ? static_cast<uint32_t>(std::atoi(argv[1])) : 10000;
+	uint32_t frameCount = (argc > 2) ? static_cast<uint32_t>(std::atoi(argv[2])) : 100;
+	std::string fontPath = (argc > 3) ? argv[3] : "";
+
+	std::unique_ptr<BenchApp> app = std::make_unique<BenchApp>(primitiveCount, frameCount, fontPath);
+	app->Startup();
+	int32_t failCount = app->RunBench();
+	app->Shutdown();
+	app.reset();
+
+	return (failCount == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "Macro.h"
+
+/** ECS ƼƼ IDԴϴ.  Ǹ 밡 ٲǷ ı ƼƼ ID ȿ ˴ϴ. */
+struct EntityID
+{
+	static const uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+	uint32_t index = INVALID_INDEX;
+	uint32_t generation = 0;
+
+	bool IsNull() const { return index == INVALID_INDEX; }
+	bool operator==(const EntityID& entityID) const { return index == entityID.index && generation == entityID.generation; }
+	bool operator!=(const EntityID& entityID) const { return !(*this == entityID); }
+};
+
+/** Ʈ Ÿ  Ʈ Ÿ Դϴ. Ʈ Ÿ ִ 64   ֽϴ. */
+using ComponentMask = uint64_t;
+
+/** Ʈ Ÿ ũ , ׸ Ÿ  ̵/ı ԼԴϴ. */
+struct ComponentInfo
+{
+	std::size_t size = 0;
+	std::size_t alignment = 0;
+	void (*move)(void* dst, void* src) = nullptr; /** dst ġ src ̵   src ıմϴ. */
+	void (*destroy)(void* ptr) = nullptr;
+};
+
+/** Ʈ ŸԸ ó   ID ϳ Ҵմϴ. */
+class ComponentRegistry
+{
+public:
+	static const uint32_t MAX_COMPONENT_TYPE = 64;
+
+	template <typename TComponent>
+	static uint32_t GetID()
+	{
+		static const uint32_t componentID = Register(MakeInfo<TComponent>());
+		return componentID;
+	}
+
+	template <typename TComponent>
+	static ComponentMask GetMask()
+	{
+		return static_cast<ComponentMask>(1) << GetID<TComponent>();
+	}
+
+	static const ComponentInfo& GetInfo(uint32_t componentID);
+
+private:
+	template <typename TComponent>
+	static ComponentInfo MakeInfo()
+	{
+		static_assert(std::is_move_constructible<TComponent>::value, "TComponent must be move constructible.");
+
+		ComponentInfo info;
+		info.size = sizeof(TComponent);
+		info.alignment = alignof(TComponent);
+		info.move = [](void* dst, void* src)
+			{
+				TComponent* component = reinterpret_cast<TComponent*>(src);
+				new (dst) TComponent(std::move(*component));
+				component->~TComponent();
+			};
+		info.destroy = [](void* ptr) { reinterpret_cast<TComponent*>(ptr)->~TComponent(); };
+
+		return info;
+	}
+
+	static uint32_t Register(const ComponentInfo& info);
+};
+
+/**
+ *  Ʈ   ƼƼ   ŰŸԴϴ.
+ * Ʈ ŸԺ 迭(SoA) ϹǷ,  (row)    ƼƼ ƮԴϴ.
+ * ƼƼ ϸ    ڸ űǷ 迭 ׻ ƴ  Դϴ.
+ */
+class Archetype
+{
+public:
+	static const std::size_t COLUMN_ALIGNMENT = 64; /** ÷ 迭 Դϴ. ĳ ΰ SIMD ε忡 ϴ. */
+
+public:
+	explicit Archetype(ComponentMask mask);
+	virtual ~Archetype();
+
+	DISALLOW_COPY_AND_ASSIGN(Archetype);
+
+	ComponentMask GetMask() const { return mask_; }
+	bool HasComponent(uint32_t componentID) const { return columnIndices_[componentID] >= 0; }
+	uint32_t GetCount() const { return static_cast<uint32_t>(entities_.size()); }
+	const EntityID* GetEntities() const { return entities_.data(); }
+
+	void* GetColumn(uint32_t componentID) const
+	{
+		int32_t columnIndex = columnIndices_[componentID];
+		return (columnIndex >= 0) ? columns_[columnIndex].data : nullptr;
+	}
+
+	template <typename TComponent>
+	TComponent* GetColumn() const
+	{
+		return reinterpret_cast<TComponent*>(GetColumn(ComponentRegistry::GetID<TComponent>()));
+	}
+
+	uint32_t AddRow(const EntityID& entityID); /**  ߰ϰ ε ȯմϴ. Ʈ ȣϴ ʿ ؾ մϴ. */
+	EntityID RemoveRow(uint32_t row); /**  Ʈ ıϰ մϴ.  ڸ Ű ƼƼ ȯϸ,  ȿ ID ȯմϴ. */
+	EntityID MoveRow(uint32_t row, Archetype* dst, uint32_t& outDstRow); /** ġ Ʈ dst ű  ıմϴ. ȯ RemoveRow ϴ. */
+
+	Archetype*& GetAddEdge(uint32_t componentID) { return addEdges_[componentID]; }
+	Archetype*& GetRemoveEdge(uint32_t componentID) { return removeEdges_[componentID]; }
+
+private:
+	struct Column
+	{
+		uint32_t componentID = 0;
+		const ComponentInfo* info = nullptr;
+		uint8_t* data = nullptr;
+	};
+
+	void Reserve(uint32_t capacity);
+	EntityID FillHole(uint32_t row); /**   row űϴ. row Ʈ ̹ ıǾų Ű ¿ մϴ. */
+
+private:
+	ComponentMask mask_ = 0;
+	std::vector<Column> columns_;
+	std::array<int32_t, ComponentRegistry::MAX_COMPONENT_TYPE> columnIndices_;
+	std::vector<EntityID> entities_;
+	uint32_t capacity_ = 0;
+
+	/** Ʈ ϳ ߰/  ̵ ŰŸԴϴ. ó ̵  äϴ. */
+	std::array<Archetype*, ComponentRegistry::MAX_COMPONENT_TYPE> addEdges_;
+	std::array<Archetype*, ComponentRegistry::MAX_COMPONENT_TYPE> removeEdges_;
+};
\ No newline at end of file
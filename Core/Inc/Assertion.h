@@ -7,9 +7,18 @@
 #include <string>
 #include <map>
 
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#include <csignal>
+#include <cwchar>
+
+/** Windows ̿ ÷ SIGTRAP Ÿ ϴ. */
+#define __debugbreak() std::raise(SIGTRAP)
+#endif
 
 #if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(RELWITHDEBINFO_MODE)
+#if defined(_WIN32)
 inline void DebugPrintF(const char* format, ...)
 {
 	static const int32_t BUFFER_SIZE = 1024;
@@ -37,6 +46,33 @@ inline void DebugPrintF(const wchar_t* format, ...)
 	/**  MinSizeRel    */
 	OutputDebugStringW(buffer);
 }
+#else
+inline void DebugPrintF(const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	std::vfprintf(stderr, format, args);
+	va_end(args);
+}
+
+inline void DebugPrintF(const wchar_t* format, ...)
+{
+	static const int32_t BUFFER_SIZE = 1024;
+	static wchar_t buffer[BUFFER_SIZE];
+	static char multiByteBuffer[BUFFER_SIZE * 4];
+
+	va_list args;
+	va_start(args, format);
+	int32_t size = std::vswprintf(buffer, BUFFER_SIZE, format, args);
+	va_end(args);
+
+	/** ǥ  Ʈ    ϹǷ ƼƮ ȯؼ մϴ. */
+	if (size >= 0 && std::wcstombs(multiByteBuffer, buffer, sizeof(multiByteBuffer)) != static_cast<std::size_t>(-1))
+	{
+		std::fputs(multiByteBuffer, stderr);
+	}
+}
+#endif
 #endif
 
 #if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(RELWITHDEBINFO_MODE)
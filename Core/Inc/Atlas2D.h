@@ -1,10 +1,14 @@
 #pragma once
 
-#include <map>
+#include <array>
+#include <memory>
+#include <unordered_map>
 
 #include "GameMath.h"
 #include "Texture2D.h"
 
+class MappedFile;
+
 class Atlas2D : public Texture2D
 {
 public:
@@ -14,18 +18,59 @@ public:
 		Vec2i size;
 	};
 
+	/**   εԴϴ. ̸  ϸ ׸  ڿ ؽ̰ UV   ʽϴ. */
+	using SpriteID = uint32_t;
+	static const SpriteID INVALID_SPRITE_ID = 0xFFFFFFFF;
+
 public:
-	Atlas2D(const std::string& imagePath, const std::string& jsonPath, const Filter& filter);
+	/** layoutPath ŷ (.cooked)̸ JSON Ľ ʰ   ״ մϴ. */
+	Atlas2D(const std::string& imagePath, const std::string& layoutPath, const Filter& filter);
+	Atlas2D(int32_t width, int32_t height, const uint8_t* pixels, const std::vector<std::string>& names, const std::vector<Block>& blocks, const Filter& filter); /** RGBA ȼ   մϴ. */
 	virtual ~Atlas2D();
 
 	DISALLOW_COPY_AND_ASSIGN(Atlas2D);
 
 	virtual void Release() override;
 
-	const std::vector<std::string>& GetKeys() const { return keys_; }
+	/** JSON ̾ƿ ,  迭, UV 迭, ̸ ̺, ڿ ̺  ̳ʸ ŷմϴ. GL ؽƮ ʿ ϴ. */
+	static void Cook(const std::string& imagePath, const std::string& jsonPath, const std::string& outputPath);
+	static bool IsCookedPath(const std::string& path);
+
+	const std::vector<std::string>& GetKeys() const; /** ε SpriteID ϴ. */
 	const Block& GetByName(const std::string& name) const;
 
+	SpriteID Find(const std::string& name) const; /** ̸  INVALID_SPRITE_ID ȯմϴ. */
+	bool IsValidSpriteID(SpriteID id) const { return id < blockCount_; }
+	const Block& GetBlock(SpriteID id) const { return blocks_[id]; }
+	const std::array<Vec2f, 4>& GetUVs(SpriteID id) const { return uvs_[id]; } /** ε  ȭ (ϴ, ϴ, , ») UVԴϴ. */
+
+private:
+	friend class AtlasBuilder;
+
+	struct CookedName;
+
+	static std::array<Vec2f, 4> ComputeUVs(const Block& block, int32_t atlasWidth, int32_t atlasHeight);
+	static void WriteCooked(const std::string& outputPath, int32_t atlasWidth, int32_t atlasHeight, const std::vector<std::string>& names, const std::vector<Block>& blocks);
+	static void ParseJson(const std::string& jsonPath, std::vector<std::string>& outKeys, std::vector<Block>& outBlocks);
+
+	void LoadJson(const std::string& jsonPath);
+	void LoadBlocks(const std::vector<std::string>& names, const std::vector<Block>& blocks);
+	void LoadCooked(const std::string& cookedPath);
+
 private:
-	std::vector<std::string> keys_;
-	std::map<std::string, Block> blocks_;
+	const Block* blocks_ = nullptr;
+	const std::array<Vec2f, 4>* uvs_ = nullptr;
+	uint32_t blockCount_ = 0;
+
+	/** JSON ε  Դϴ. */
+	std::vector<Block> blockStorage_;
+	std::vector<std::array<Vec2f, 4>> uvStorage_;
+	std::unordered_map<std::string, SpriteID> spriteIDs_;
+
+	/** ŷ Ͽ ε , /UV/̸ ε 並  ŵϴ. */
+	std::unique_ptr<MappedFile> cookedFile_;
+	const CookedName* cookedNames_ = nullptr;
+	const char* cookedStrings_ = nullptr;
+
+	mutable std::vector<std::string> keys_; /** ŷ  GetKeys ȣ  äϴ. */
 };
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Atlas2D.h"
+
+/**
+ *  ̹ ϳ ̻ Atlas2D  ŷմϴ.
+ * ̹ ̿ padding ŭ   ΰ, ׵θ ȼ extrude ŭ ٱ  ͸   ϴ.
+ */
+class AtlasBuilder
+{
+public:
+	AtlasBuilder(int32_t pageSize = 2048, int32_t padding = 1, int32_t extrude = 1);
+	virtual ~AtlasBuilder() {}
+
+	DISALLOW_COPY_AND_ASSIGN(AtlasBuilder);
+
+	void Add(const std::string& name, const std::string& path);
+	void Add(const std::string& name, int32_t width, int32_t height, int32_t channels, const uint8_t* pixels); /** stbi_load ó ̹ ڵ ȼ մϴ. */
+	void Clear();
+
+	uint32_t GetImageCount() const { return static_cast<uint32_t>(images_.size()); }
+
+	/** ߰ ̹ ŷ  Atlas2D մϴ.  Ʋ󽺴 ҽ Ŵ մϴ. */
+	std::vector<Atlas2D*> Build(const Texture2D::Filter& filter) const;
+
+	/** ŷ  "basePath_.png" "basePath_.cooked" մϴ.  Atlas2D ڷ ٷ ε  ֽϴ. */
+	void Cook(const std::string& basePath) const;
+
+private:
+	struct Image
+	{
+		std::string name;
+		int32_t width = 0;
+		int32_t height = 0;
+		std::vector<uint8_t> pixels; /** RGBA */
+	};
+
+	struct Page
+	{
+		int32_t width = 0;
+		int32_t height = 0;
+		std::vector<uint8_t> pixels; /** RGBA */
+		std::vector<std::string> names;
+		std::vector<Atlas2D::Block> blocks;
+	};
+
+	void Pack(std::vector<Page>& outPages) const;
+	void Blit(const Image& image, int32_t x, int32_t y, Page& outPage) const;
+
+private:
+	static const int32_t CHANNELS = 4;
+
+	int32_t pageSize_ = 0;
+	int32_t padding_ = 0;
+	int32_t extrude_ = 0;
+
+	std::vector<Image> images_;
+};
\ No newline at end of file
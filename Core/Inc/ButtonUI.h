@@ -6,6 +6,7 @@
 #include "Collision2D.h"
 #include "InputManager.h"
 #include "IEntityUI.h"
+#include "TextRun.h"
 
 class TTFont;
 class RenderStateManager;
@@ -62,6 +63,7 @@ private:
 	Rect2D bound_;
 	State state_ = State::DISABLED;
 	Vec2f textPos_;
+	TextRun textRun_; /** ġ  ģ ؽƮԴϴ. */
 	std::map<State, Vec4f> stateColors_;
 
 	std::function<void()> clickEvent_ = nullptr;
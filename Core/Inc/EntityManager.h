@@ -1,12 +1,18 @@
 #pragma once
 
-#include <array>
 #include <memory>
-#include <map>
-
+#include <new>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "EntityPool.h"
+#include "FlatHashMap.h"
 #include "IEntity.h"
+#include "NameID.h"
 
-/** ƼƼ Ŵ ̱Դϴ. */
+/** ƼƼ Ŵ ̱Դϴ. ƼƼ ŸԺ ûũ Ǯ Ǹ, /ı  O(1)Դϴ. */
 class EntityManager
 {
 public:
@@ -18,67 +24,67 @@ public:
 	template <typename TEntity, typename... Args>
 	TEntity* Create(Args&&... args)
 	{
-		if (!(0 <= size_ && size_ < MAX_ENTITY_SIZE))
-		{
-			return nullptr;
-		}
+		static_assert(std::is_base_of<IEntity, TEntity>::value, "TEntity must inherit IEntity.");
+		static_assert(alignof(TEntity) <= EntityPool::BLOCK_ALIGNMENT, "TEntity alignment exceeds the entity pool block alignment.");
 
-		int32_t entityID = -1;
-		for (uint32_t index = 0; index < size_; ++index)
-		{
-			if (!entities_[index] && !usage_[index])
-			{
-				entityID = static_cast<int32_t>(index);
-				break;
-			}
-		}
+		static const uint32_t poolIndex = poolTypeCount_++;
 
-		if (entityID == -1)
+		EntityPool* pool = (poolIndex < pools_.size()) ? pools_[poolIndex].get() : nullptr;
+		if (!pool) /** ŸԺ ù Create Ǯ ϴ. */
 		{
-			entityID = size_++;
+			pool = CreatePool(poolIndex, sizeof(TEntity));
 		}
 
-		usage_[entityID] = true;
-		entities_[entityID] = std::make_unique<TEntity>(args...);
+		EntityBlock* block = pool->Allocate();
+		TEntity* entity = new (EntityPool::GetStorage(block)) TEntity(args...);
 
-		return reinterpret_cast<TEntity*>(entities_[entityID].get());
+		entity->entityBlock_ = block;
+		block->entity = entity;
+		entityCount_++;
+
+		return entity;
 	}
 
 	void Destroy(const IEntity* entity);
 
-	void Register(const std::string& name, IEntity* entity);
-	bool IsRegistration(const std::string& name);
-	void Unregister(const std::string& name);
+	void Register(const NameID& name, IEntity* entity);
+	bool IsRegistration(const NameID& name);
+	void Unregister(const NameID& name);
 
 	template <typename TEntity>
-	TEntity* GetByName(const std::string& name)
+	TEntity* GetByName(const NameID& name)
 	{
-		auto it = entityCache_.find(name);
-		if (it == entityCache_.end())
+		IEntity** entity = entityCache_.Find(name);
+		if (!entity)
 		{
 			return nullptr;
 		}
 
-		return reinterpret_cast<TEntity*>(it->second);
+		return reinterpret_cast<TEntity*>(*entity);
 	}
 
+	uint32_t GetEntityCount() const { return entityCount_; }
+
 private:
 	friend class IApp;
 
 	EntityManager() = default;
 	virtual ~EntityManager() {}
 
+	bool IsManaged(const IEntity* entity) const;
+	EntityPool* CreatePool(uint32_t poolIndex, std::size_t entityByteSize);
 	void Unregister(const IEntity* entity);
 
 	void Cleanup();
 
 private:
 	static EntityManager instance_;
-	static const uint32_t MAX_ENTITY_SIZE = 200;
+	static uint32_t poolTypeCount_; /** ƼƼ ŸԸ ó Create  Ǯ ε ϳ Ҵմϴ. */
 
-	uint32_t size_ = 0;
-	std::array<std::unique_ptr<IEntity>, MAX_ENTITY_SIZE> entities_;
-	std::array<bool, MAX_ENTITY_SIZE> usage_;
+	void* heap_ = nullptr; /** ƼƼ Ǯ ûũ  mimalloc Դϴ. Cleanup   մϴ. */
+	std::vector<std::unique_ptr<EntityPool>> pools_;
+	uint32_t entityCount_ = 0;
 
-	std::map<std::string, IEntity*> entityCache_;
+	FlatHashMap<NameID, IEntity*> entityCache_;
+	std::unordered_map<const IEntity*, std::vector<NameID>> entityNames_; /** Ǯ ƼƼ  ̸Դϴ. ͷ ̸ ȸ  մϴ. */
 };
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Macro.h"
+
+class IEntity;
+class EntityPool;
+
+/** 
+ * ƼƼ Ǯ  Դϴ. 
+ *  ûũ ʿ 迭  ιǷ, ûũ  ƼƼ ޸𸮴   ƴ  ̾ϴ.
+ */
+struct EntityBlock
+{
+	EntityPool* pool = nullptr;
+	EntityBlock* nextFreeBlock = nullptr; /**  ִ ϳ  ħ  ƮԴϴ. */
+	void* storage = nullptr; /**  Ͽ شϴ ƼƼ ޸Դϴ. */
+	IEntity* entity = nullptr; /**   ƴϸ nullptrԴϴ. */
+	uint32_t nameCount = 0; /** Register  ̸ Դϴ. 0̸ ı  ̸ ǥ ȸ ʽϴ. */
+};
+
+/**
+ *  Ÿ ƼƼ  ũ   δ ûũ ǮԴϴ.
+ * ûũ mimalloc  Ҵϸ, Ǯ ı  ̵ Ƿ ƼƼ ּҴ ˴ϴ.
+ */
+class EntityPool
+{
+public:
+	static const std::size_t BLOCK_ALIGNMENT = 16;
+	static const std::size_t CHUNK_BYTE_SIZE = 64 * 1024;
+
+public:
+	EntityPool(void* heap, std::size_t entityByteSize);
+	virtual ~EntityPool();
+
+	DISALLOW_COPY_AND_ASSIGN(EntityPool);
+
+	/** Create/Destroy ȣǹǷ  ζ Ӵϴ. ûũ   AllocateChunk ȣմϴ. */
+	EntityBlock* Allocate()
+	{
+		if (!freeBlock_)
+		{
+			AllocateChunk();
+		}
+
+		EntityBlock* block = freeBlock_;
+		freeBlock_ = block->nextFreeBlock;
+		block->nextFreeBlock = nullptr;
+		count_++;
+
+		return block;
+	}
+
+	/** ƼƼ Ҹڴ ȣϴ ʿ  ȣؾ մϴ.   Ǯ  ȣϴ ʿ Ȯմϴ. */
+	void Free(EntityBlock* block)
+	{
+		block->entity = nullptr;
+		block->nameCount = 0;
+		block->nextFreeBlock = freeBlock_;
+		freeBlock_ = block;
+		count_--;
+	}
+	void Cleanup(); /**   ƼƼ  Releaseϰ ıմϴ. */
+
+	static void* GetStorage(EntityBlock* block) { return block->storage; }
+
+	uint32_t GetCount() const { return count_; }
+	uint32_t GetCapacity() const { return static_cast<uint32_t>(chunks_.size()) * blockCountPerChunk_; }
+
+private:
+	void AllocateChunk();
+	EntityBlock* GetBlock(uint8_t* chunk, uint32_t index) const { return reinterpret_cast<EntityBlock*>(chunk + blockCountPerChunk_ * storageByteSize_) + index; }
+
+private:
+	void* heap_ = nullptr;
+	std::size_t storageByteSize_ = 0; /** ƼƼ ϳ ϴ Ʈ Դϴ. ûũ ȿ ƼƼ  ̱⵵ մϴ. */
+	uint32_t blockCountPerChunk_ = 0;
+
+	std::vector<uint8_t*> chunks_;
+	EntityBlock* freeBlock_ = nullptr;
+	uint32_t count_ = 0;
+};
\ No newline at end of file
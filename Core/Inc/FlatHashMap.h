@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "NameID.h"
+
+/** FlatHashMap ⺻ ؽ ԼԴϴ. Ű ŸԸ Ưȭؼ մϴ. */
+template <typename TKey>
+struct FlatHash;
+
+template <>
+struct FlatHash<NameID>
+{
+	uint64_t operator()(const NameID& key) const { return key.GetHash(); }
+};
+
+/**
+ *  Ž縦 ϴ  巹 ؽ Դϴ.
+ * -  ϳ 迭  Ǹ, ȸ    Ž ϴ.
+ * -       äǷ Ž ̰ þ ʽϴ.
+ * - /   ּҰ ٲ  Ƿ Find  ͸     ˴ϴ.
+ * - ȸ    ʽϴ.
+ */
+template <typename TKey, typename TValue, typename THash = FlatHash<TKey>>
+class FlatHashMap
+{
+public:
+	struct Slot
+	{
+		TKey key;
+		TValue value;
+		bool bIsUsed = false;
+	};
+
+	template <typename TSlot>
+	class Iterator
+	{
+	public:
+		Iterator(TSlot* slot, TSlot* end) : slot_(slot), end_(end) { SkipUnused(); }
+
+		TSlot& operator*() const { return *slot_; }
+		TSlot* operator->() const { return slot_; }
+		Iterator& operator++() { ++slot_; SkipUnused(); return *this; }
+		bool operator==(const Iterator& iterator) const { return slot_ == iterator.slot_; }
+		bool operator!=(const Iterator& iterator) const { return slot_ != iterator.slot_; }
+
+	private:
+		void SkipUnused() { while (slot_ != end_ && !slot_->bIsUsed) { ++slot_; } }
+
+	private:
+		TSlot* slot_ = nullptr;
+		TSlot* end_ = nullptr;
+	};
+
+public:
+	FlatHashMap() = default;
+	virtual ~FlatHashMap() {}
+
+	TValue* Find(const TKey& key)
+	{
+		std::size_t index = 0;
+		return FindIndex(key, index) ? &slots_[index].value : nullptr;
+	}
+
+	const TValue* Find(const TKey& key) const
+	{
+		std::size_t index = 0;
+		return FindIndex(key, index) ? &slots_[index].value : nullptr;
+	}
+
+	bool Contains(const TKey& key) const
+	{
+		std::size_t index = 0;
+		return FindIndex(key, index);
+	}
+
+	/** Ű ̹   ٲ ʰ false ȯմϴ. */
+	bool Insert(const TKey& key, const TValue& value)
+	{
+		if ((size_ + 1) * 4 > slots_.size() * 3)
+		{
+			Rehash(slots_.empty() ? MIN_CAPACITY : slots_.size() * 2);
+		}
+
+		std::size_t index = GetHomeIndex(key);
+		while (slots_[index].bIsUsed)
+		{
+			if (slots_[index].key == key)
+			{
+				return false;
+			}
+
+			index = (index + 1) & (slots_.size() - 1);
+		}
+
+		slots_[index].key = key;
+		slots_[index].value = value;
+		slots_[index].bIsUsed = true;
+		size_++;
+
+		return true;
+	}
+
+	bool Erase(const TKey& key)
+	{
+		std::size_t index = 0;
+		if (!FindIndex(key, index))
+		{
+			return false;
+		}
+
+		/**  ִ ڸ   ,  ġ  ڸ Žؾ ϴ   ɴϴ. */
+		std::size_t mask = slots_.size() - 1;
+		std::size_t hole = index;
+		for (std::size_t next = (hole + 1) & mask; slots_[next].bIsUsed; next = (next + 1) & mask)
+		{
+			std::size_t home = GetHomeIndex(slots_[next].key);
+			if (((next - home) & mask) >= ((next - hole) & mask))
+			{
+				slots_[hole] = std::move(slots_[next]);
+				hole = next;
+			}
+		}
+
+		slots_[hole] = Slot();
+		size_--;
+
+		return true;
+	}
+
+	void Clear()
+	{
+		slots_.clear();
+		size_ = 0;
+	}
+
+	std::size_t GetSize() const { return size_; }
+	bool IsEmpty() const { return size_ == 0; }
+
+	Iterator<Slot> begin() { return Iterator<Slot>(slots_.data(), slots_.data() + slots_.size()); }
+	Iterator<Slot> end() { return Iterator<Slot>(slots_.data() + slots_.size(), slots_.data() + slots_.size()); }
+	Iterator<const Slot> begin() const { return Iterator<const Slot>(slots_.data(), slots_.data() + slots_.size()); }
+	Iterator<const Slot> end() const { return Iterator<const Slot>(slots_.data() + slots_.size(), slots_.data() + slots_.size()); }
+
+private:
+	static const std::size_t MIN_CAPACITY = 16;
+
+	/** Ǻġ ؽ ؽ  Ʈ    ε մϴ. */
+	std::size_t GetHomeIndex(const TKey& key) const
+	{
+		uint64_t hash = THash()(key) * 0x9E3779B97F4A7C15ULL;
+		return static_cast<std::size_t>(hash >> shift_);
+	}
+
+	bool FindIndex(const TKey& key, std::size_t& outIndex) const
+	{
+		if (size_ == 0)
+		{
+			return false;
+		}
+
+		std::size_t index = GetHomeIndex(key);
+		while (slots_[index].bIsUsed)
+		{
+			if (slots_[index].key == key)
+			{
+				outIndex = index;
+				return true;
+			}
+
+			index = (index + 1) & (slots_.size() - 1);
+		}
+
+		return false;
+	}
+
+	void Rehash(std::size_t capacity)
+	{
+		std::vector<Slot> slots(capacity);
+		slots.swap(slots_);
+
+		shift_ = 64;
+		for (std::size_t size = capacity; size > 1; size >>= 1)
+		{
+			shift_--;
+		}
+
+		size_ = 0;
+		for (auto& slot : slots)
+		{
+			if (slot.bIsUsed)
+			{
+				Insert(slot.key, slot.value);
+			}
+		}
+	}
+
+private:
+	std::vector<Slot> slots_;
+	std::size_t size_ = 0;
+	uint32_t shift_ = 64;
+};
\ No newline at end of file
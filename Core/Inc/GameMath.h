@@ -1,10 +1,15 @@
 #pragma once
 
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 #include <random>
 
+#if !defined(_MSC_VER)
+#define __forceinline inline __attribute__((always_inline))
+#endif
+
 const float PI          = 3.141592654f;
 const float TWO_PI      = 6.283185307f;
 const float ONE_DIV_PI  = 0.318309886f;
@@ -27,7 +32,7 @@ namespace GameMath
 
 	__forceinline bool NearZero(float value, float epsilon = EPSILON)
 	{
-		return (std::fabsf(value) <= epsilon);
+		return (std::fabs(value) <= epsilon);
 	}
 
 	template <typename T>
@@ -44,17 +49,17 @@ namespace GameMath
 
 	__forceinline float Sqrt(float x)
 	{
-		return std::sqrtf(x);
+		return std::sqrt(x);
 	}
 
 	__forceinline float Abs(float x)
 	{
-		return std::fabsf(x);
+		return std::fabs(x);
 	}
 
 	__forceinline float Fmod(float x, float y)
 	{
-		return std::fmodf(x, y);
+		return std::fmod(x, y);
 	}
 
 	template <typename T>
@@ -127,7 +132,7 @@ namespace GameMath
 	/** https://gist.github.com/publik-void/067f7f2fef32dbe5c27d6e215f824c91 */
 	__forceinline float ASin(float value)
 	{
-		float x = std::fabsf(value);
+		float x = std::fabs(value);
 		float omx = 1.0f - x;
 		if (omx < 0.0f)
 		{
@@ -151,7 +156,7 @@ namespace GameMath
 	/** https://gist.github.com/publik-void/067f7f2fef32dbe5c27d6e215f824c91 */
 	__forceinline float ACos(float value)
 	{
-		float x = std::fabsf(value);
+		float x = std::fabs(value);
 		float omx = 1.0f - x;
 		if (omx < 0.0f)
 		{
@@ -425,6 +430,11 @@ struct Vec2f
 		return Vec2f(x * v.x, y * v.y);
 	}
 
+	Vec2f operator*(float s) const
+	{
+		return Vec2f(x * s, y * s);
+	}
+
 	Vec2f& operator+=(Vec2f&& v) noexcept
 	{
 		x += v.x;
@@ -827,6 +837,11 @@ struct Vec3f
 		return Vec3f(x * v.x, y * v.y, z * v.z);
 	}
 
+	Vec3f operator*(float s) const
+	{
+		return Vec3f(x * s, y * s, z * s);
+	}
+
 	Vec3f& operator+=(Vec3f&& v) noexcept
 	{
 		x += v.x;
@@ -1230,6 +1245,11 @@ struct Vec4f
 		return Vec4f(x * v.x, y * v.y, z * v.z, w * v.w);
 	}
 
+	Vec4f operator*(float s) const
+	{
+		return Vec4f(x * s, y * s, z * s, w * s);
+	}
+
 	Vec4f& operator+=(Vec4f&& v) noexcept
 	{
 		x += v.x;
@@ -2703,12 +2723,14 @@ struct Quat
 
 	Vec3f operator*(Vec3f&& vec) const
 	{
-		return v * 2.0f * Vec3f::Dot(v, vec) + vec * (w * w - Vec3f::Dot(v, v)) + Vec3f::Cross(v, vec) * 2.0f * w;
+		Vec3f u(x, y, z);
+		return u * 2.0f * Vec3f::Dot(u, vec) + vec * (w * w - Vec3f::Dot(u, u)) + Vec3f::Cross(u, vec) * 2.0f * w;
 	}
 
 	Vec3f operator*(const Vec3f& vec) const
 	{
-		return v * 2.0f * Vec3f::Dot(v, vec) + vec * (w * w - Vec3f::Dot(v, v)) + Vec3f::Cross(v, vec) * 2.0f * w;
+		Vec3f u(x, y, z);
+		return u * 2.0f * Vec3f::Dot(u, vec) + vec * (w * w - Vec3f::Dot(u, u)) + Vec3f::Cross(u, vec) * 2.0f * w;
 	}
 
 	Quat& operator+=(Quat&& q) noexcept
@@ -2988,11 +3010,14 @@ struct Quat
 			float z;
 			float w;
 		};
+#if defined(_MSC_VER)
+		/** ڰ ִ  ͸ ü δ  MSVC Ȯ̹Ƿ ٸ Ϸ մϴ. */
 		struct
 		{
 			Vec3f v;
 			float w;
 		};
+#endif
 		float data[4];
 	};
 };
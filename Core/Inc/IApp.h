@@ -3,10 +3,10 @@
 #include <array>
 #include <functional>
 #include <memory>
-#include <map>
 #include <string>
 #include <vector>
 
+#include "FlatHashMap.h"
 #include "Macro.h"
 
 class IGameScene;
@@ -14,7 +14,11 @@ class IGameScene;
 class IApp
 {
 public:
-	IApp(const char* title, int32_t x, int32_t y, int32_t w, int32_t h, bool bIsResizble, bool bIsFullscreen);
+	/**
+	 * bIsHeadless ̸  OpenGL ؽƮ  ʰ NullGL 鿣 մϴ.
+	 * ̶ w, h  ȭ ũ Ǹ  ImGui ʱȭ ʽϴ.
+	 */
+	IApp(const char* title, int32_t x, int32_t y, int32_t w, int32_t h, bool bIsResizble, bool bIsFullscreen, bool bIsHeadless = false);
 	virtual ~IApp();
 
 	DISALLOW_COPY_AND_ASSIGN(IApp); /**        */
@@ -25,19 +29,19 @@ public:
 	void Run();
 
 	void SetCurrentScene(IGameScene* scene) { currentScene_ = scene; }
-	void AddSceneByName(const std::string& name, IGameScene* scene);
-	void DeleteScenesByName(const std::string& name);
+	void AddSceneByName(const NameID& name, IGameScene* scene);
+	void DeleteScenesByName(const NameID& name);
 
 	template <typename TScene>
-	TScene* GetSceneByName(const std::string& name)
+	TScene* GetSceneByName(const NameID& name)
 	{
-		auto it = scenes_.find(name);
-		if (it == scenes_.end())
+		IGameScene** scene = scenes_.Find(name);
+		if (!scene)
 		{
 			return nullptr; // can't find.
 		}
 
-		return reinterpret_cast<TScene*>(it->second);
+		return reinterpret_cast<TScene*>(*scene);
 	}
 
 	static IApp* Get();
@@ -49,7 +53,8 @@ protected:
 	static IApp* instance_;
 
 	void* window_ = nullptr;
+	bool bIsHeadless_ = false;
 	
 	IGameScene* currentScene_ = nullptr;
-	std::map<std::string, IGameScene*> scenes_;
+	FlatHashMap<NameID, IGameScene*> scenes_;
 };
\ No newline at end of file
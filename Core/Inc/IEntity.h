@@ -2,6 +2,8 @@
 
 #include "Macro.h"
 
+struct EntityBlock;
+
 /**  Ŭ ƼƼ ̽, ƼƼ ݵ  ̽ ӹ޾ƾ մϴ. */
 class IEntity
 {
@@ -15,6 +17,14 @@ public:
 	virtual void Release() = 0;
 	bool IsInitialized() const { return bIsInitialized_; }
 
+	/** Tick ڱ ڽ ¸ ٲ۴ٸ true ȯϵ մϴ.  ParallelTick ̷ ƼƼ Ŀ 忡 Tickմϴ. */
+	virtual bool IsThreadSafe() const { return false; }
+
 protected:
 	bool bIsInitialized_ = false;
+
+private:
+	friend class EntityManager;
+
+	EntityBlock* entityBlock_ = nullptr; /** ƼƼ Ŵ Ǯ Դϴ. ͷ  O(1) ã  մϴ. */
 };
\ No newline at end of file
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "Macro.h"
 #include "IApp.h"
 
+class IEntity;
+
 /**    ̽Դϴ. */
 class IGameScene
 {
@@ -25,8 +28,16 @@ public:
 
 
 protected:
+	/**
+	 * ƼƼ Tickմϴ. ParallelTick մϴ.
+	 * - IsThreadSafe() true ƼƼ Ŀ 忡  Tickϰ,    ٸ   ƼƼ  忡 Tickմϴ.
+	 * -  ܰ谡 ġ Ƿ   ƼƼ ٸ ƼƼ ¸ ϰ   ֽϴ.
+	 * - parallelEntities    ۾ Դϴ.
+	 */
+	static void ParallelTickEntities(const std::vector<IEntity*>& entities, float deltaSeconds, std::vector<IEntity*>& parallelEntities);
+
 	template <typename TGameScene>
-	TGameScene* Switch(const std::string& name)
+	TGameScene* Switch(const NameID& name)
 	{
 		bIsSwitched_ = true;
 
@@ -18,6 +18,7 @@ public:
 	DISALLOW_COPY_AND_ASSIGN(IGameScene2D);
 
 	virtual void Tick(float deltaSeconds) override;
+	void ParallelTick(float deltaSeconds); /** Tick  Դϴ. IsThreadSafe() true ƼƼ Ŀ 忡  Tickմϴ. */
 	virtual void Render() override;
 	virtual void Enter() override;
 	virtual void Exit() override;
@@ -34,4 +35,7 @@ protected:
 	std::vector<IEntity*> updateEntities_;
 	std::vector<IEntity2D*> renderEntities_;
 	std::vector<IEntityUI*> uiEntities_;
+
+private:
+	std::vector<IEntity*> parallelEntities_; /** ParallelTick   մϴ. */
 };
\ No newline at end of file
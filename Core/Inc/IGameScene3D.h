@@ -1,7 +1,8 @@
 #pragma once
 
-#include <map>
+#include <vector>
 
+#include "FlatHashMap.h"
 #include "IGameScene.h"
 
 class Camera3D;
@@ -19,6 +20,7 @@ public:
 	DISALLOW_COPY_AND_ASSIGN(IGameScene3D);
 
 	virtual void Tick(float deltaSeconds) override;
+	void ParallelTick(float deltaSeconds); /** Tick  Դϴ. IsThreadSafe() true ƼƼ Ŀ 忡  Tickմϴ. */
 	virtual void Render() = 0;
 	virtual void Enter() override;
 	virtual void Exit() override;
@@ -33,8 +35,12 @@ protected:
 
 	Camera3D* mainCamera_ = nullptr;
 
-	std::map<std::string, IEntity*> updateEntities_;
-	std::map<std::string, IEntity3D*> render3dEntities_;
-	std::map<std::string, IEntity2D*> render2dEntities_;
-	std::map<std::string, IEntityUI*> uiEntities_;
+	FlatHashMap<NameID, IEntity*> updateEntities_;
+	FlatHashMap<NameID, IEntity3D*> render3dEntities_;
+	FlatHashMap<NameID, IEntity2D*> render2dEntities_;
+	FlatHashMap<NameID, IEntityUI*> uiEntities_;
+
+private:
+	std::vector<IEntity*> tickEntities_; /** ParallelTick   մϴ. */
+	std::vector<IEntity*> parallelEntities_; /** ParallelTick   մϴ. */
 };
\ No newline at end of file
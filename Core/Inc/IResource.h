@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "Macro.h"
 
 /**  Ŭ   ҽ ̽,   ҽ(ؽó, ޽, Ʈ ) ݵ  ̽ ӹ޾ƾ մϴ. */
@@ -16,4 +18,9 @@ public:
 
 protected:
 	bool bIsInitialized_ = false;
+
+private:
+	friend class ResourceManager;
+
+	uint32_t resourceSlot_ = 0xFFFFFFFF; /** ҽ Ŵ  εԴϴ. ͷ  O(1) ã  մϴ. */
 };
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Macro.h"
+
+/**
+ * ۾ ׷  ۾ Դϴ. 0 Ǹ ׷  ̸,  īͿ ϴ ۾ ٵ˴ϴ.
+ * īʹ ٸ ۾     ־ մϴ.
+ */
+class JobCounter
+{
+public:
+	JobCounter() = default;
+	virtual ~JobCounter() {}
+
+	DISALLOW_COPY_AND_ASSIGN(JobCounter);
+
+	bool IsDone() const; /**  ۾  ۾  ѱ  false̹Ƿ, true̸ ī͸ ıص ˴ϴ. */
+
+private:
+	friend class JobSystem;
+
+	struct Continuation
+	{
+		std::function<void()> job;
+		JobCounter* counter = nullptr;
+		bool bIsMainThread = false;
+	};
+
+	std::atomic<uint32_t> count_ = 0;
+	mutable std::mutex mutex_;
+	std::vector<Continuation> continuations_; /** īͰ 0 Ǹ  ۾Դϴ. */
+};
+
+/**
+ *  ý ̱Դϴ.
+ * - ھ ŭ Ŀ 尡   ۾ ,  ٸ    ɴϴ.
+ * -  嵵 0  , Wait ߿ ۾ Բ óմϴ.
+ * - GL ȣó  忡 ؾ ϴ ۾ ScheduleMainThread , IApp::Run   óմϴ.
+ */
+class JobSystem
+{
+public:
+	using Job = std::function<void()>;
+	using RangeJob = std::function<void(uint32_t, uint32_t)>; /** [begin, end)  óմϴ. */
+
+public:
+	DISALLOW_COPY_AND_ASSIGN(JobSystem);
+
+	static JobSystem& GetRef();
+	static JobSystem* GetPtr();
+
+	void Schedule(const Job& job, JobCounter* counter = nullptr);
+	void Schedule(const Job& job, JobCounter* counter, JobCounter* dependency); /** dependency  ڿ մϴ. */
+	void ScheduleMainThread(const Job& job, JobCounter* counter = nullptr);
+	void ScheduleMainThread(const Job& job, JobCounter* counter, JobCounter* dependency);
+
+	/** [0, count)  batchSize   մϴ. Ϸ counter ٷ մϴ. */
+	void ParallelFor(uint32_t count, uint32_t batchSize, const RangeJob& job, JobCounter* counter);
+	void ParallelFor(uint32_t count, uint32_t batchSize, const RangeJob& job); /**     ٸϴ. */
+
+	/** īͰ 0   ۾ Բ óϸ ٸϴ.  忡 ȣϸ   ۾ óմϴ. */
+	void Wait(JobCounter* counter);
+
+	void RunMainThreadJobs(); /**  忡 ȣؾ ϸ, IApp::Run   ȣմϴ. */
+
+	uint32_t GetWorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+	bool IsMainThread() const { return std::this_thread::get_id() == mainThreadID_; }
+
+private:
+	friend class IApp;
+
+	struct Entry
+	{
+		Job job;
+		JobCounter* counter = nullptr;
+	};
+
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<Entry> entries; /**   ڿ, ġ  տ ϴ. */
+	};
+
+	JobSystem() = default;
+	virtual ~JobSystem() {}
+
+	void Startup(); /** IApp ο ȣؾ մϴ. */
+	void Shutdown(); /** IApp ο ȣؾ մϴ. */
+
+	void Push(Entry&& entry);
+	void PushMainThread(Entry&& entry);
+	bool AddContinuation(JobCounter* dependency, const Job& job, JobCounter* counter, bool bIsMainThread);
+	bool TryPop(Entry& outEntry);
+	bool TryRunOne();
+	void Execute(Entry& entry);
+	void Finish(JobCounter* counter);
+	void WorkerLoop(uint32_t queueIndex);
+
+private:
+	static JobSystem instance_;
+
+	std::thread::id mainThreadID_;
+	std::vector<std::unique_ptr<Queue>> queues_; /** 0   ܺ  , 1ʹ Ŀ Դϴ. */
+	std::vector<std::thread> workers_;
+
+	std::atomic<uint32_t> pendingCount_ = 0;
+	std::atomic<bool> bIsQuit_ = false;
+	std::mutex wakeMutex_;
+	std::condition_variable wakeCondition_;
+
+	std::mutex mainThreadMutex_;
+	std::vector<Entry> mainThreadEntries_;
+};
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Macro.h"
+
+/** б  ޸  Դϴ.    ʰ ε 並 ״ մϴ. */
+class MappedFile
+{
+public:
+	explicit MappedFile(const std::string& path);
+	virtual ~MappedFile();
+
+	DISALLOW_COPY_AND_ASSIGN(MappedFile);
+
+	const uint8_t* GetData() const { return data_; }
+	std::size_t GetSize() const { return size_; }
+
+	/**  ġ T Ÿ ؼմϴ.   nullptr ȯմϴ. */
+	template <typename T>
+	const T* GetPtr(std::size_t offset, std::size_t count = 1) const
+	{
+		if (offset > size_ || count > (size_ - offset) / sizeof(T))
+		{
+			return nullptr;
+		}
+
+		return reinterpret_cast<const T*>(data_ + offset);
+	}
+
+private:
+	void* file_ = nullptr;
+	void* mapping_ = nullptr;
+	const uint8_t* data_ = nullptr;
+	std::size_t size_ = 0;
+};
\ No newline at end of file
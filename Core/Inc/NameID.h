@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * ̸ ڿ FNV-1a 64Ʈ ؽԴϴ.
+ * - ڿ ͷ  constexpr NameID  Ÿӿ ؽõ˴ϴ. (: static constexpr NameID PLAYER("Player");)
+ * - ̸ 񱳴 ؽ   ̸, ؽð   ٸ ̸  ̸ մϴ.
+ */
+class NameID
+{
+public:
+	constexpr NameID() = default;
+	constexpr NameID(const char* name) : hash_(Hash(name)) {}
+	constexpr NameID(const char* name, std::size_t length) : hash_(Hash(name, length)) {}
+	NameID(const std::string& name) : hash_(Hash(name.data(), name.size())) {}
+
+	constexpr uint64_t GetHash() const { return hash_; }
+
+	constexpr bool operator==(const NameID& nameID) const { return hash_ == nameID.hash_; }
+	constexpr bool operator!=(const NameID& nameID) const { return hash_ != nameID.hash_; }
+	constexpr bool operator<(const NameID& nameID) const { return hash_ < nameID.hash_; }
+
+	/** seed  ؽø ѱ  Ʈ ̾   ؽð ˴ϴ. */
+	static constexpr uint64_t Hash(const char* name, std::size_t length, uint64_t seed = FNV_OFFSET_BASIS)
+	{
+		uint64_t hash = seed;
+		for (std::size_t index = 0; index < length; ++index)
+		{
+			hash ^= static_cast<uint64_t>(static_cast<uint8_t>(name[index]));
+			hash *= FNV_PRIME;
+		}
+
+		return hash;
+	}
+
+	static constexpr uint64_t Hash(const char* name)
+	{
+		uint64_t hash = FNV_OFFSET_BASIS;
+		for (; *name != '\0'; ++name)
+		{
+			hash ^= static_cast<uint64_t>(static_cast<uint8_t>(*name));
+			hash *= FNV_PRIME;
+		}
+
+		return hash;
+	}
+
+private:
+	static constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+	static constexpr uint64_t FNV_PRIME = 0x00000100000001B3ULL;
+
+private:
+	uint64_t hash_ = FNV_OFFSET_BASIS;
+};
+
+/** "Player"_name · NameID ϴ. */
+constexpr NameID operator""_name(const char* name, std::size_t length)
+{
+	return NameID(name, length);
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ *  OpenGL ؽƮ   ϱ  帮 鿣Դϴ.
+ * glad Լ ͸ ȣ Ƚ Ʈ  ϴ  üմϴ.
+ *  (glMapBuffer, glMapBufferRange) CPU ޸𸮸 ȯϹǷ   δ ״ մϴ.
+ */
+namespace NullGL
+{
+
+/** 帮 鿣尡 ϴ Դϴ. */
+struct Stats
+{
+	uint64_t callCount = 0; /**  ü GL Լ ü ȣ ȽԴϴ. */
+	uint64_t drawCallCount = 0; /** glDraw* ȣ ȽԴϴ. */
+	uint64_t vertexCount = 0; /** ο ݷ  (νϽ ) Դϴ. */
+	uint64_t bufferAllocateByteSize = 0; /** glBufferData, glBufferStorage Ҵ Ʈ Դϴ. */
+	uint64_t bufferUploadByteSize = 0; /** glBufferData, glBufferSubData ۵ Ʈ Դϴ. */
+	uint64_t textureUploadByteSize = 0; /** ؽó    ۵ Ʈ Դϴ. */
+};
+
+/** glad Լ ͸ 帮  üմϴ. */
+void Load();
+
+/**  ϵ 踦 ϴ. */
+const Stats& GetStats();
+
+/** ϵ 踦 ʱȭմϴ. */
+void ResetStats();
+
+}
\ No newline at end of file
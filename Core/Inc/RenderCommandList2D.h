@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+
+#include "RenderManager2D.h"
+
+/**
+ * - ٸ 忡 2D ׸ û   ִ Ŀǵ ƮԴϴ.
+ * - Begin/End ̿ RenderManager2D Draw* ޼带 ȣϸ,   û  Ʈ   ϵ˴ϴ.
+ * -   Ʈ  忡 RenderManager2D::Submit մϴ.
+ * - DrawSpriteInstanced   ϴ.
+ */
+class RenderCommandList2D
+{
+public:
+	RenderCommandList2D() = default;
+	virtual ~RenderCommandList2D() {}
+
+	DISALLOW_COPY_AND_ASSIGN(RenderCommandList2D);
+
+	void Begin(const Camera2D* camera = nullptr); /**        մϴ. ī޶    û մϴ. */
+	void End();
+
+	void SetSortLayer(uint8_t layer) { sortLayer_ = layer; } /** Submit   忡  ̾Դϴ. */
+
+	bool IsEmpty() const { return items_.empty(); }
+	uint32_t GetVertexCount() const { return static_cast<uint32_t>(vertices_.size()); }
+
+private:
+	friend class RenderManager2D;
+	friend class StaticBatch2D;
+
+	struct Item
+	{
+		RenderManager2D::RenderCommand::Type type;
+		DrawMode drawMode;
+		bool bIsQuad;
+		ITexture* texture;
+		uint8_t sortLayer;
+		uint32_t startVertexIndex;
+		uint32_t vertexCount;
+	};
+
+	RenderManager2D::Vertex* Allocate(const RenderManager2D::RenderCommand::Type& type, const DrawMode& drawMode, bool bIsQuad, ITexture* texture, uint32_t vertexCount, uint32_t& outUnit);
+
+private:
+	bool bIsRecording_ = false;
+	uint8_t sortLayer_ = 0;
+
+	bool bHasCullBounds_ = false;
+	Vec2f cullMinPos_;
+	Vec2f cullMaxPos_;
+	RenderManager2D::Stats stats_;
+
+	std::vector<Item> items_;
+	std::vector<RenderManager2D::Vertex> vertices_;
+};
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include <array>
 #include <map>
 #include <queue>
+#include <unordered_map>
+#include <vector>
 
 #include "GameMath.h"
 #include "IResource.h"
@@ -11,11 +13,19 @@
 class Atlas2D;
 class Camera2D;
 class IEntity2D;
+class IndexBuffer;
+class RenderCommandList2D;
 class ITexture;
 class ResourceManager;
 class Shader;
+class StaticBatch2D;
+class StreamTexture2D;
+class TextLayout;
+class TextRun;
+class TextureArray2D;
 class TTFont;
 class VertexBuffer;
+struct GlyphQuad;
 
 /**
  * - 2D  Ŵ ̱Դϴ.
@@ -35,41 +45,149 @@ public:
 		float transparent = 1.0f; /** Ʈ Դϴ. 1.0 ̸ , 0.0 ̸  Դϴ. */
 		bool bIsFlipH = false; /** Ʈ η   Դϴ. */
 		bool bIsFlipV = false; /** Ʈ η   Դϴ. */
+		bool bIsCulling = true; /** ī޶   Ʈ ׸   Դϴ. */
 	};
 
+	/**
+	 * - νϽ ׸ Ʈ ϳ Դϴ. ũ 32ƮԴϴ.
+	 * - 簢  ؽ ̴    Ȯմϴ.
+	 * - ũ(size) ̸ ش   ׸ϴ.
+	 */
+	struct SpriteInstance
+	{
+		void SetRotate(float rotate)
+		{
+			float wrap = GameMath::Fmod(rotate, TWO_PI);
+			wrap = (wrap < 0.0f) ? wrap + TWO_PI : wrap;
+			packedRotate = static_cast<uint16_t>(wrap * ONE_DIV_2PI * 65535.0f);
+		}
+
+		void SetTransparent(float transparent)
+		{
+			packedTransparent = static_cast<uint16_t>(GameMath::Clamp<float>(transparent, 0.0f, 1.0f) * 65535.0f);
+		}
+
+		void SetUV(const Vec2f& uv0, const Vec2f& uv1) /** uv0 », uv1 ϴԴϴ. */
+		{
+			packedUV[0] = static_cast<uint16_t>(GameMath::Clamp<float>(uv0.x, 0.0f, 1.0f) * 65535.0f);
+			packedUV[1] = static_cast<uint16_t>(GameMath::Clamp<float>(uv0.y, 0.0f, 1.0f) * 65535.0f);
+			packedUV[2] = static_cast<uint16_t>(GameMath::Clamp<float>(uv1.x, 0.0f, 1.0f) * 65535.0f);
+			packedUV[3] = static_cast<uint16_t>(GameMath::Clamp<float>(uv1.y, 0.0f, 1.0f) * 65535.0f);
+		}
+
+		void SetBlend(const Vec3f& blend, float factor)
+		{
+			packedBlend[0] = static_cast<uint8_t>(GameMath::Clamp<float>(blend.x, 0.0f, 1.0f) * 255.0f);
+			packedBlend[1] = static_cast<uint8_t>(GameMath::Clamp<float>(blend.y, 0.0f, 1.0f) * 255.0f);
+			packedBlend[2] = static_cast<uint8_t>(GameMath::Clamp<float>(blend.z, 0.0f, 1.0f) * 255.0f);
+			packedBlend[3] = static_cast<uint8_t>(GameMath::Clamp<float>(factor, 0.0f, 1.0f) * 255.0f);
+		}
+
+		Vec2f center;
+		Vec2f size;
+		uint16_t packedRotate = 0; /** [0, 2)  ȸ  ȭ Դϴ. */
+		uint16_t packedTransparent = 0xFFFF;
+		uint16_t packedUV[4] = { 0x0000, 0x0000, 0xFFFF, 0xFFFF, };
+		uint8_t packedBlend[4] = { 0x00, 0x00, 0x00, 0x00, }; /** RGB ȥ , A ȥ Դϴ. */
+	};
+
+	struct Stats /**    Դϴ. */
+	{
+		uint64_t uploadByteSize = 0; /**  ۷ ε Ʈ Դϴ. */
+		uint32_t flushCount = 0; /**  ۸ ε ȽԴϴ. */
+		uint32_t drawCallCount = 0; /**  ȣ ο  Դϴ. */
+		uint32_t stateChangeCount = 0; /** ̴ ü ؽó ε Ƚ Դϴ. */
+		uint32_t unsortedDrawCallCount = 0; /**  忡   ״ ׷   ο  Դϴ. */
+		uint32_t unsortedStateChangeCount = 0; /**  忡   ״ ׷     Դϴ. */
+		uint32_t culledCount = 0; /** ī޶  ̶ ׸  û Դϴ. */
+		uint32_t acceptedCount = 0; /** ī޶  ˻縦  û Դϴ. */
+	};
+
+	/**  ձ 簢 𼭸   ȭ   (MIN << level) ߿ մϴ. */
+	static const uint32_t MAX_SLICE_LEVEL = 5;
+	static const uint32_t MIN_CIRCLE_SLICE_SIZE = 8;
+	static const uint32_t MAX_CIRCLE_SLICE_SIZE = MIN_CIRCLE_SLICE_SIZE << (MAX_SLICE_LEVEL - 1);
+	static const uint32_t MIN_CORNER_SLICE_SIZE = 2;
+	static const uint32_t MAX_CORNER_SLICE_SIZE = MIN_CORNER_SLICE_SIZE << (MAX_SLICE_LEVEL - 1);
+
 public:
 	DISALLOW_COPY_AND_ASSIGN(RenderManager2D);
 
 	static RenderManager2D& GetRef();
 	static RenderManager2D* GetPtr();
 
-	void Begin(const Camera2D* camera2D);
+	/**
+	 * - bIsSorted true̸ ׸ û ٷ  ʰ (̾, ̴, ؽó, )  Ű Բ մϴ.
+	 * - ϵ û End ȣ (Ǵ  ۰  á )   յǾ ׷ϴ.
+	 * -  ̾ ȿ ׸   Ƿ, ġ Ҵ SetSortLayer ̾  մϴ.
+	 */
+	void Begin(const Camera2D* camera2D, bool bIsSorted = false);
 	void End();
 
-	void DrawPoint(const Vec2f& point, const Vec4f& color, float pointSize);
-	void DrawLine(const Vec2f& startPos, const Vec2f& endPos, const Vec4f& color);
-	void DrawLine(const Vec2f& startPos, const Vec4f& startColor, const Vec2f& endPos, const Vec4f& endColor);
-	void DrawTriangle(const Vec2f& fromPos, const Vec2f& byPos, const Vec2f& toPos, const Vec4f& color);
-	void DrawTriangle(const Vec2f& fromPos, const Vec4f& fromColor, const Vec2f& byPos, const Vec4f& byColor, const Vec2f& toPos, const Vec4f& toColor);
-	void DrawTriangleWireframe(const Vec2f& fromPos, const Vec2f& byPos, const Vec2f& toPos, const Vec4f& color);
-	void DrawTriangleWireframe(const Vec2f& fromPos, const Vec4f& fromColor, const Vec2f& byPos, const Vec4f& byColor, const Vec2f& toPos, const Vec4f& toColor);
-	void DrawRect(const Vec2f& center, float w, float h, const Vec4f& color, float rotate);
-	void DrawRectWireframe(const Vec2f& center, float w, float h, const Vec4f& color, float rotate);
-	void DrawRoundRect(const Vec2f& center, float w, float h, float side, const Vec4f& color, float rotate);
-	void DrawRoundRectWireframe(const Vec2f& center, float w, float h, float side, const Vec4f& color, float rotate);
-	void DrawCircle(const Vec2f& center, float radius, const Vec4f& color);
-	void DrawCircleWireframe(const Vec2f& center, float radius, const Vec4f& color);
+	void SetSortLayer(uint8_t layer) { sortLayer_ = layer; } /**  忡  ׸ û ̾ մϴ. */
+
+	void DrawPoint(const Vec2f& point, const Vec4f& color, float pointSize, bool bIsCulling = true);
+	void DrawLine(const Vec2f& startPos, const Vec2f& endPos, const Vec4f& color, bool bIsCulling = true);
+	void DrawLine(const Vec2f& startPos, const Vec4f& startColor, const Vec2f& endPos, const Vec4f& endColor, bool bIsCulling = true);
+	void DrawTriangle(const Vec2f& fromPos, const Vec2f& byPos, const Vec2f& toPos, const Vec4f& color, bool bIsCulling = true);
+	void DrawTriangle(const Vec2f& fromPos, const Vec4f& fromColor, const Vec2f& byPos, const Vec4f& byColor, const Vec2f& toPos, const Vec4f& toColor, bool bIsCulling = true);
+	void DrawTriangleWireframe(const Vec2f& fromPos, const Vec2f& byPos, const Vec2f& toPos, const Vec4f& color, bool bIsCulling = true);
+	void DrawTriangleWireframe(const Vec2f& fromPos, const Vec4f& fromColor, const Vec2f& byPos, const Vec4f& byColor, const Vec2f& toPos, const Vec4f& toColor, bool bIsCulling = true);
+	void DrawRect(const Vec2f& center, float w, float h, const Vec4f& color, float rotate, bool bIsCulling = true);
+	void DrawRectWireframe(const Vec2f& center, float w, float h, const Vec4f& color, float rotate, bool bIsCulling = true);
+	void DrawRoundRect(const Vec2f& center, float w, float h, float side, const Vec4f& color, float rotate, bool bIsCulling = true);
+	void DrawRoundRectWireframe(const Vec2f& center, float w, float h, float side, const Vec4f& color, float rotate, bool bIsCulling = true);
+	void DrawCircle(const Vec2f& center, float radius, const Vec4f& color, bool bIsCulling = true);
+	void DrawCircleWireframe(const Vec2f& center, float radius, const Vec4f& color, bool bIsCulling = true);
 
 	void DrawSprite(ITexture* texture, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options);
 	void DrawSprite(Atlas2D* atlas, const std::string& name, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options);
+
+	/** ׷ ȭ ȼ ũ⸦ ؽó Ʈӿ  ʿ  ûմϴ. */
+	void DrawSprite(StreamTexture2D* texture, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options);
+
+	/** spriteID Atlas2D::Find ̸  Atlas2D::SpriteIDԴϴ. ڿ ȸ UV   ׸ϴ. */
+	void DrawSprite(Atlas2D* atlas, uint32_t spriteID, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options);
+
+	/** ؽó 迭 Ʈ ϴ ̾   ϳ Ŀǵ յ˴ϴ. */
+	void DrawSprite(TextureArray2D* textureArray, int32_t layer, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options);
+	void DrawSprite(TextureArray2D* textureArray, int32_t layer, Atlas2D* atlas, const std::string& name, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options);
+	void DrawSprite(TextureArray2D* textureArray, int32_t layer, Atlas2D* atlas, uint32_t spriteID, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options);
 	
-	void DrawString(TTFont* font, const std::wstring& text, const Vec2f& pos, const Vec4f& color);
+	/**    ȣ  ׸ϴ. */
+	void DrawSpriteInstanced(ITexture* texture, const SpriteInstance* instances, uint32_t count);
+
+	void DrawString(TTFont* font, const std::wstring& text, const Vec2f& pos, const Vec4f& color, bool bIsCulling = true);
+
+	/** ۸ scale Ȯ/ ׸ϴ. SDF Ʈ(TTFont::IsSDF)    մϴ. */
+	void DrawString(TTFont* font, const std::wstring& text, const Vec2f& pos, float scale, const Vec4f& color, bool bIsCulling = true);
+
+	/** ĳõ ؽƮ  ׸ϴ.  ۸ ȸ  ĳõ 簢  ۷ űϴ. */
+	void DrawString(TextRun* textRun, const Vec2f& pos, const Vec4f& color, bool bIsCulling = true);
+	void DrawString(TextRun* textRun, const Vec2f& pos, float scale, const Vec4f& color, bool bIsCulling = true);
+
+	/**    ģ ؽƮ ġ ׸ϴ. pos ġ  »Դϴ. */
+	void DrawString(TextLayout* textLayout, const Vec2f& pos, const Vec4f& color, bool bIsCulling = true);
+
+	/**
+	 * - ٸ 忡  ģ Ŀǵ Ʈ ޵  մϴ.
+	 * - Begin/End ̿  常 ȣؾ մϴ.
+	 */
+	void Submit(RenderCommandList2D** lists, uint32_t count);
+
+	/**   ġ transform  ׸ϴ. Begin/End ̿ ȣؾ մϴ. */
+	void DrawBatch(StaticBatch2D* batch, const Mat4x4& transform);
 
 	/** The Begin/End call structure should not be used*/
 	void BatchRenderEntities(const Camera2D* camera, IEntity2D** entites, uint32_t count);
 
+	const Stats& GetStats() const { return stats_; }
+	void ResetStats() { stats_ = Stats(); } /** IApp     ȣմϴ. */
+
 private:
 	friend class IApp;
+	friend class RenderCommandList2D;
+	friend class StaticBatch2D;
 
 	RenderManager2D() = default;
 	virtual ~RenderManager2D() {}
@@ -97,14 +215,17 @@ private:
 			GEOMETRY = 0x00,
 			STRING   = 0x01,
 			SPRITE   = 0x02,
+			SPRITE_INSTANCE = 0x03,
+			SPRITE_ARRAY = 0x04,
+			STRING_SDF = 0x05,
 		};
 
 		DrawMode drawMode;
 		uint32_t startVertexIndex;
 		uint32_t vertexCount;
 		Type type;
-		ITexture* texture[MAX_TEXTURE_UNIT] = { nullptr, };
-		TTFont* font[MAX_TEXTURE_UNIT] = { nullptr, };
+		bool bIsQuad = false; /**  4  簢 Ǿ  ε ۷ ׸ Ȯմϴ. */
+		ITexture* texture[MAX_TEXTURE_UNIT] = { nullptr, }; /** Ʈ ؽó Ʈ Ʋ󽺸  մϴ. */
 	};
 
 	void Startup(); /** IApp ο ϴ ޼Դϴ. */
@@ -113,8 +234,40 @@ private:
 	void Flush();
 	bool IsFullCommandQueue(uint32_t vertexCount);
 
+	void DrawGlyphQuads(TTFont* font, const GlyphQuad* quads, uint32_t count, const Vec2f& pos, float scale, const Vec4f& color);
+	void DrawSpriteQuad(const RenderCommand::Type& type, ITexture* texture, int32_t layer, const std::array<Vec2f, 4>& uvs, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options);
+
+	/**    ȯմϴ. Ŀǵ Ʈ  ̶ Ʈ,    ׸, ƴ϶ PushCommand Ҵմϴ. */
+	Vertex* AllocateVertices(const RenderCommand::Type& type, const DrawMode& drawMode, bool bIsQuad, ITexture* texture, uint32_t vertexCount, uint32_t& outUnit);
+
+	/**  Ŀǵ  ϸ ϰ, ƴ϶  Ŀǵ带 ߰    ε ȯմϴ. */
+	uint32_t PushCommand(const RenderCommand::Type& type, const DrawMode& drawMode, bool bIsQuad, ITexture* texture, uint32_t vertexCount, uint32_t& outUnit);
+
+	/** ȭ (ȼ) ´ ̺  մϴ. */
+	uint32_t CalculateSliceLevel(float pixelLength, uint32_t minSliceCount);
+
+	/**  ܰ(  + 1 ) ϰ   ȯմϴ. */
+	uint32_t CalculateCircleOutline(const Vec2f& center, float radius, Vec2f* outOutline);
+
+	/**  𼭸   ܰ ϰ   ȯմϴ.   ù °  ̾ϴ. */
+	uint32_t CalculateRoundRectOutline(const Vec2f& center, float w, float h, float side, float rotate, Vec2f* outOutline);
+
+	/** Begin ޵ ī޶   AABB ȭ ۿ ִ ˻ϰ 踦 մϴ. */
+	static void SetCullBounds(const Camera2D* camera, bool& bOutHasBounds, Vec2f& outMinPos, Vec2f& outMaxPos);
+	bool IsCulled(const Vec2f& minPos, const Vec2f& maxPos);
+	bool IsCulled(const Vec2f& center, float radius);
+	bool IsCulled(const Vec2f& pos0, const Vec2f& pos1, const Vec2f& pos2);
+
+	static void SetVertexAttributes(); /** ε VAO Vertex ü Ӽ մϴ. */
+
+	static void CopyVertices(const RenderCommand::Type& type, uint32_t unit, const Vertex* srcVertexPtr, uint32_t vertexCount, Vertex* dstVertexPtr);
+
+	/**  忡 ϵ ׸ ׸  Ű      Flushմϴ. */
+	void FlushSorted();
+
 private:
 	static RenderManager2D instance_;
+	static thread_local RenderCommandList2D* recordingList_; /**  尡   Ŀǵ ƮԴϴ. */
 
 	RenderStateManager* renderStateMgr_ = nullptr;
 	ResourceManager* resourceMgr_ = nullptr;
@@ -127,9 +280,44 @@ private:
 	uint32_t vertexArrayObject_ = 0;
 	VertexBuffer* vertexBuffer_ = nullptr;
 
+	static const uint32_t MAX_ROUND_RECT_OUTLINE_SIZE = 4 * (MAX_CORNER_SLICE_SIZE + 1);
+	float pixelScale_ = 1.0f; /**   1 ȭ ȼ Դϴ. Begin ȣ  մϴ. */
+
+	static const int32_t MAX_QUAD_SIZE = MAX_VERTEX_BUFFER_SIZE / 4;
+	IndexBuffer* quadIndexBuffer_ = nullptr; /** 簢(0, 1, 2, 2, 3, 0)   ε Դϴ. */
+
+	static const uint32_t MAX_SPRITE_INSTANCE_SIZE = 16384;
+	uint32_t instanceVertexArrayObject_ = 0;
+	VertexBuffer* instanceBuffer_ = nullptr;
+
 	std::map<RenderCommand::Type, Shader*> shaders_;
 	std::queue<RenderCommand> commandQueue_;
 
+	bool bHasCullBounds_ = false;
+	Vec2f cullMinPos_;
+	Vec2f cullMaxPos_;
+
 	bool originEnableDepth_ = false;
 	bool originEnableCull_ = false;
+
+	Stats stats_;
+
+	struct SortItem /**  忡  ׸ ûԴϴ. */
+	{
+		uint64_t key; /** [63:56] ̾, [55:52] Ŀǵ Ÿ, [51:48] ׸ , [47:32] ؽó , [31:0]   */
+		RenderCommand::Type type;
+		DrawMode drawMode;
+		bool bIsQuad;
+		ITexture* texture;
+		uint32_t startVertexIndex;
+		uint32_t vertexCount;
+	};
+
+	bool bIsSorted_ = false;
+	uint8_t sortLayer_ = 0;
+	uint32_t sortVertexCount_ = 0;
+	std::vector<SortItem> sortItems_;
+	std::vector<SortItem> sortScratch_;
+	std::vector<Vertex> sortVertices_;
+	std::unordered_map<const ITexture*, uint32_t> sortTextureSlots_;
 };
\ No newline at end of file
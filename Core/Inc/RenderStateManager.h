@@ -39,6 +39,7 @@ public:
 	void SetMultisampleMode(bool bIsEnable);
 	void SetCullFaceMode(bool bIsEnable);
 	bool HasGLExtension(const std::string& extension);
+	bool IsHeadless() const { return bIsHeadless_; }
 
 	void BeginFrame(float red, float green, float blue, float alpha, float depth = 1.0f, uint8_t stencil = 0);
 	void EndFrame();
@@ -51,6 +52,7 @@ private:
 
 	void PreStartup(); /** IApp ο ϴ ޼Դϴ. */
 	void PostStartup(); /** IApp ο ϴ ޼Դϴ. */
+	void HeadlessStartup(int32_t width, int32_t height); /** IApp ο ϴ ޼Դϴ. */
 	void Shutdown(); /** IApp ο ϴ ޼Դϴ. */
 
 private:
@@ -63,4 +65,7 @@ private:
 	std::vector<Vec2i> displaySizes_;
 
 	std::vector<std::string> extensions_; /** OpenGL Ȯ Դϴ. */
+
+	bool bIsHeadless_ = false; /**  OpenGL ؽƮ  NullGL 鿣 ϴ Ȯմϴ. */
+	Vec2i headlessSize_; /** 帮 忡   ȭ ũԴϴ. */
 };
\ No newline at end of file
@@ -1,12 +1,33 @@
 #pragma once
 
-#include <array>
+#include <condition_variable>
 #include <memory>
-#include <map>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
 
-#include "IResource.h"
+#include "FlatHashMap.h"
+#include "ITexture.h"
 
-/** ҽ Ŵ ̱ ŬԴϴ. */
+class Texture2D;
+
+/** ҽ  ε Դϴ.  Ǹ 밡 ٲǷ ı ҽ ڵ ȿ ˴ϴ. */
+template <typename TResource>
+struct ResourceHandle
+{
+	static const uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+	uint32_t index = INVALID_INDEX;
+	uint32_t generation = 0;
+
+	bool IsNull() const { return index == INVALID_INDEX; }
+	bool operator==(const ResourceHandle& handle) const { return index == handle.index && generation == handle.generation; }
+	bool operator!=(const ResourceHandle& handle) const { return !(*this == handle); }
+};
+
+/** ҽ Ŵ ̱ ŬԴϴ. ҽ ũⰡ þ  ʿ Ǹ, /ı/ڵ ˻  O(1)Դϴ. */
 class ResourceManager
 {
 public:
@@ -18,67 +39,124 @@ public:
 	template <typename TResource, typename... Args>
 	TResource* Create(Args&&... args)
 	{
-		if (!(0 <= size_ && size_ < MAX_RESOURCE_SIZE))
-		{
-			return nullptr;
-		}
+		std::unique_ptr<TResource> resource = std::make_unique<TResource>(args...);
+		TResource* resourcePtr = resource.get();
+
+		Insert(std::move(resource));
 
-		int32_t resourceID = -1;
-		for (uint32_t index = 0; index < size_; ++index)
+		return resourcePtr;
+	}
+
+	template <typename TResource>
+	ResourceHandle<TResource> GetHandle(const TResource* resource) const
+	{
+		ResourceHandle<TResource> handle;
+		if (IsManaged(resource))
 		{
-			if (!resources_[index] && !usage_[index])
-			{
-				resourceID = static_cast<int32_t>(index);
-				break;
-			}
+			handle.index = resource->resourceSlot_;
+			handle.generation = slots_[handle.index].generation;
 		}
 
-		if (resourceID == -1)
+		return handle;
+	}
+
+	template <typename TResource>
+	bool IsValid(const ResourceHandle<TResource>& handle) const
+	{
+		return handle.index < slots_.size() && slots_[handle.index].generation == handle.generation && slots_[handle.index].resource != nullptr;
+	}
+
+	/** ıǾų   ڵ̸ nullptr ȯմϴ. */
+	template <typename TResource>
+	TResource* Get(const ResourceHandle<TResource>& handle) const
+	{
+		if (!IsValid(handle))
 		{
-			resourceID = size_++;
+			return nullptr;
 		}
 
-		usage_[resourceID] = true;
-		resources_[resourceID] = std::make_unique<TResource>(args...);
+		return static_cast<TResource*>(slots_[handle.index].resource.get());
+	}
 
-		return reinterpret_cast<TResource*>(resources_[resourceID].get());
+	template <typename TResource>
+	void Destroy(const ResourceHandle<TResource>& handle)
+	{
+		if (IsValid(handle))
+		{
+			Remove(handle.index);
+		}
 	}
 
+	/**
+	 * ̹ ڵ Ŀ 忡 ȼ  (PBO) ϰ,   ε常 մϴ.
+	 * ȯ ؽó IsInitialized() true  ں   ֽϴ. DDS/KTX2 ؼ  εմϴ.
+	 */
+	Texture2D* CreateTexture2DAsync(const std::string& path, const ITexture::Filter& filter);
+	void UploadAsyncTextures(); /** ڵ  ؽó εմϴ.  忡 ȣؾ ϸ, IApp::Run   ȣմϴ. */
+	void FlushAsyncTextures(); /**  񵿱 ؽó ε  մϴ. */
+	uint32_t GetAsyncTextureCount() const { return static_cast<uint32_t>(asyncTextures_.size()); }
+
 	void Destroy(const IResource* resource);
 
-	void Register(const std::string& name, IResource* resource);
-	bool IsRegistration(const std::string& name);
-	void Unregister(const std::string& name);
+	void Register(const NameID& name, IResource* resource);
+	bool IsRegistration(const NameID& name);
+	void Unregister(const NameID& name);
 
 	template <typename TResource>
-	TResource* GetByName(const std::string& name)
+	TResource* GetByName(const NameID& name)
 	{
-		auto it = resourceCache_.find(name);
-		if (it == resourceCache_.end())
+		IResource** resource = resourceCache_.Find(name);
+		if (!resource)
 		{
 			return nullptr;
 		}
 
-		return reinterpret_cast<TResource*>(it->second);
+		return reinterpret_cast<TResource*>(*resource);
 	}
 
+	uint32_t GetResourceCount() const { return resourceCount_; }
+
 private:
 	friend class IApp;
 
 	ResourceManager() = default;
 	virtual ~ResourceManager() {}
 	
+	struct AsyncTexture;
+
+	struct Slot
+	{
+		std::unique_ptr<IResource> resource = nullptr;
+		uint32_t generation = 0;
+		uint32_t nextFreeSlot = ResourceHandle<IResource>::INVALID_INDEX; /**  ִ Գ  ħ  ƮԴϴ. */
+		std::vector<NameID> names; /** Register  ̸Դϴ. ͷ ̸ ȸ  մϴ. */
+	};
+
+	bool IsManaged(const IResource* resource) const;
+	void Insert(std::unique_ptr<IResource> resource);
+	void Remove(uint32_t slot);
 	void Unregister(const IResource* resource); /**  ޼ ο ؾ մϴ. */
 
+	void StartupWorkers();
+	void ShutdownWorkers();
+	void RunWorker();
+
 	void Cleanup(); /**  ޼ IApp ؾ մϴ. */
 
 private:
 	static ResourceManager instance_;
-	static const uint32_t MAX_RESOURCE_SIZE = 200;
 
-	uint32_t size_ = 0;
-	std::array<std::unique_ptr<IResource>, MAX_RESOURCE_SIZE> resources_;
-	std::array<bool, MAX_RESOURCE_SIZE> usage_;
+	std::vector<Slot> slots_;
+	uint32_t freeSlot_ = ResourceHandle<IResource>::INVALID_INDEX;
+	uint32_t resourceCount_ = 0;
+
+	FlatHashMap<NameID, IResource*> resourceCache_;
 
-	std::map<std::string, IResource*> resourceCache_;
+	/** 񵿱 ؽó ε Դϴ. asyncTextures_  忡 մϴ. */
+	std::vector<std::shared_ptr<AsyncTexture>> asyncTextures_;
+	std::vector<std::thread> workers_;
+	std::queue<std::shared_ptr<AsyncTexture>> jobs_;
+	std::mutex jobMutex_;
+	std::condition_variable jobCondition_;
+	bool bIsStopWorkers_ = false;
 };
\ No newline at end of file
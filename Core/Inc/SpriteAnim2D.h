@@ -22,6 +22,7 @@ public:
 	Atlas2D* GetAtlas() { return atlas_; }
 
 	const std::string& GetCurrentClip() const { return clips_.at(currentIndex_).name; }
+	uint32_t GetCurrentClipID() const { return clips_.at(currentIndex_).spriteID; } /**   ȸ  Atlas2D::SpriteIDԴϴ. */
 
 	bool IsDuration() const { return bIsDuration_; }
 	float GetTime() const { return time_; }
@@ -33,6 +34,7 @@ private:
 	struct Clip
 	{
 		std::string name;
+		uint32_t spriteID = 0;
 		float time = 0.0f;
 	};
 
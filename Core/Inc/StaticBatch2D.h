@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+
+#include "IResource.h"
+#include "RenderCommandList2D.h"
+
+class VertexBuffer;
+
+/**
+ * -  ʴ 2D ׸ û(UI г, , Ÿϸ ) GPU δ  ġԴϴ.
+ * - Begin/End ̿ RenderManager2D Draw* ޼带 ȣϸ û ϵǰ, End STATIC  ۷ ϴ.
+ * - ׸  RenderManager2D::DrawBatch ȣϸ, ̴/ؽó ٲ    ׸ϴ.
+ * - Invalidate ȣ Ŀ ٽ Begin/End ؾ մϴ.
+ */
+class StaticBatch2D : public IResource
+{
+public:
+	StaticBatch2D();
+	virtual ~StaticBatch2D();
+
+	DISALLOW_COPY_AND_ASSIGN(StaticBatch2D);
+
+	virtual void Release() override;
+
+	void Begin(const Camera2D* camera = nullptr);
+	void End();
+
+	void Invalidate() { bIsDirty_ = true; }
+	bool IsDirty() const { return bIsDirty_; }
+
+	uint32_t GetVertexCount() const { return vertexCount_; }
+	uint32_t GetSegmentCount() const { return static_cast<uint32_t>(segments_.size()); }
+
+private:
+	friend class RenderManager2D;
+
+	void Bake();
+
+private:
+	static class ResourceManager* resourceMgr_;
+
+	bool bIsDirty_ = true;
+	RenderCommandList2D commandList_;
+
+	std::vector<RenderManager2D::RenderCommand> segments_; /** ̴ ؽó      ׸ Դϴ. */
+	uint32_t vertexCount_ = 0;
+
+	uint32_t vertexArrayObject_ = 0;
+	VertexBuffer* vertexBuffer_ = nullptr;
+};
\ No newline at end of file
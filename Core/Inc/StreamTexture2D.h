@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "ITexture.h"
+#include "TextureFile.h"
+
+class MappedFile;
+
+/**
+ *    Ʈϴ ؽóԴϴ. DDS/KTX2 ϸ մϴ.
+ *    (MAX_PINNED_SIZE ) ø,   ؽó ƮӰ  ȿ øų ϴ.
+ * ϴ  ū  GL_TEXTURE_BASE_LEVEL մϴ.
+ */
+class StreamTexture2D : public ITexture
+{
+public:
+	StreamTexture2D(const std::string& path, const Filter& filter);
+	virtual ~StreamTexture2D();
+
+	DISALLOW_COPY_AND_ASSIGN(StreamTexture2D);
+
+	virtual void Release() override;
+	virtual void Active(uint32_t unit) const override;
+
+	/** ȭ鿡 ׷ ȼ ũ⸦ մϴ.     ũ   ū ũ⿡ ´  ûմϴ. Ŀ 忡 ȣ  ֽϴ. */
+	void RequestSize(float screenWidth, float screenHeight);
+
+	int32_t GetWidth() const { return static_cast<int32_t>(desc_.width); }
+	int32_t GetHeight() const { return static_cast<int32_t>(desc_.height); }
+	uint32_t GetLevelCount() const { return desc_.levelCount; }
+	uint32_t GetPinnedLevel() const { return pinnedLevel_; }
+	uint32_t GetResidentLevel() const { return residentLevel_; }
+	uint32_t GetTargetLevel() const { return targetLevel_; }
+	std::size_t GetResidentByteSize() const;
+
+private:
+	friend class TextureStreamer;
+
+	void UploadLevel(uint32_t level, const void* pixels); /** residentLevel_ - 1  ø BASE_LEVEL ϴ. pixels nullptr ε PBO нϴ. */
+	void EvictLevel(); /** residentLevel_   BASE_LEVEL Դϴ. */
+
+private:
+	static const uint32_t MAX_PINNED_SIZE = 64;
+	static const uint32_t NOT_REQUESTED = 0xFFFFFFFF;
+
+	std::shared_ptr<MappedFile> file_ = nullptr; /** ε  ۾   մϴ. */
+	TextureFile::Desc desc_;
+	uint32_t textureID_ = 0;
+
+	uint32_t pinnedLevel_ = 0; /** ׻ ϴ  ū  Դϴ. */
+	uint32_t residentLevel_ = 0; /**  ϴ  ū  (BASE_LEVEL)Դϴ. */
+	std::atomic<uint32_t> requestedLevel_ = NOT_REQUESTED; /** ̹ ӿ û  Դϴ. û  NOT_REQUESTEDԴϴ. */
+	uint32_t targetLevel_ = 0; /** ƮӰ ߷  Դϴ. */
+	uint64_t lastRequestFrame_ = 0;
+	bool bIsLoading_ = false;
+};
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "GameMath.h"
+
+class ITexture;
+class World;
+
+/** ECS 2D ƼƼ ġ, ũ, ȸ ƮԴϴ. */
+struct Transform2D
+{
+	Vec2f position;
+	Vec2f size = Vec2f(1.0f, 1.0f);
+	float rotate = 0.0f;
+};
+
+/** ECS 2D ƼƼ ӵ ӵ ƮԴϴ. */
+struct Velocity2D
+{
+	Vec2f linear;
+	float angular = 0.0f;
+};
+
+/** ECS 2D ƼƼ Ʈ ƮԴϴ. uv0 », uv1 ϴԴϴ. */
+struct Sprite2D
+{
+	ITexture* texture = nullptr;
+	Vec2f uv0 = Vec2f(0.0f, 0.0f);
+	Vec2f uv1 = Vec2f(1.0f, 1.0f);
+	float transparent = 1.0f;
+};
+
+/** World ؼ ϴ ⺻ 2D ýԴϴ. */
+namespace System2D
+{
+	/** Transform2D Velocity2D  ƼƼ ̵/ȸŵϴ. */
+	void Move(World& world, float deltaSeconds);
+
+	/**
+	 * Transform2D Sprite2D  ƼƼ RenderManager2D νϽ ׸ϴ.
+	 * ӵ ƼƼ ؽó    ο ݷ ϴ. RenderManager2D Begin/End ̿ ȣؾ մϴ.
+	 */
+	void RenderSprites(World& world);
+}
\ No newline at end of file
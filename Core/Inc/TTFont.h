@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GameMath.h"
@@ -19,11 +22,37 @@ struct Glyph
 	float xadvance;
 };
 
-/** Ʈ Ÿ Ʈ .ttf  մϴ. */
+/** ۸ ϳ ׸ 簢Դϴ. ġ ؽƮ  ġκ  ǥԴϴ. */
+struct GlyphQuad
+{
+	Vec2f pos0; /** » */
+	Vec2f pos1; /** ϴ */
+	Vec2f uv0;
+	Vec2f uv1;
+};
+
+struct stbtt_fontinfo;
+
+/**
+ * Ʈ Ÿ Ʈ .ttf  մϴ.
+ * - ڵ Ʈ  ϸ     ۸  Ʋ󽺿 ϴ.
+ * -   ϸ ۸ ó   ȭ ĳմϴ. (ѱ, CJK  ū )
+ */
 class TTFont : public ITexture
 {
 public:
 	explicit TTFont(const std::string& path, int32_t beginCodePoint, int32_t endCodePoint, float fontSize);
+
+	/**
+	 *  ۸ ĳø ϴ Ʈ մϴ.
+	 * - ۸ atlasSize x atlasSize ũ Ʋ󽺸 ̺ (shelf)  ġմϴ.
+	 * - Ʋ󽺰         մϴ.
+	 * -  ӿ     ׷ ʾ  Ƿ  ʽϴ.  RenderManager2D::End Ѿϴ.
+	 * -  RenderCommandList2D   ȿ Submitؾ մϴ.
+	 * - StaticBatch2D  ؽƮ ۸ ġ ǹǷ,  Ʈ   ϴ.
+	 * - bIsSDF ̸ ۸ ȣ ִ Ÿ(SDF) ȭմϴ. ϳ Ʋ󽺷 DrawString scale  ϰ ׸  ֽϴ.
+	 */
+	explicit TTFont(const std::string& path, float fontSize, int32_t atlasSize = 1024, bool bIsSDF = false);
 	virtual ~TTFont();
 
 	DISALLOW_COPY_AND_ASSIGN(TTFont);
@@ -31,16 +60,46 @@ public:
 	virtual void Release() override;
 	virtual void Active(uint32_t unit) const override;
 
-	const Glyph& GetGlyph(int32_t codePoint) const;
+	Glyph GetGlyph(int32_t codePoint) const; /**  Ʈ ٸ 忡    Ƿ  ȿ   ȯմϴ. */
 	int32_t GetAtlasWidth() const { return atlasWidth_; }
 	int32_t GetAtlasHeight() const { return atlasHeight_; }
 
 	bool IsValidCodePoint(int32_t codePoint) const;
+	bool IsDynamic() const { return bIsDynamic_; }
+	bool IsSDF() const { return bIsSDF_; }
+	float GetFontSize() const { return fontSize_; }
+	uint64_t GetEvictionCount() const; /**  ۸ ĳÿ   ȽԴϴ. ۸ ġ ٲ Ȯ  մϴ. */
+	float GetAscent() const { return ascent_; } /** ؼ ۸ ֻܱ ŸԴϴ. */
+	float GetDescent() const { return descent_; } /** ؼ ۸ ϴܱ ŸԴϴ. Դϴ. */
+	float GetLineHeight() const { return ascent_ - descent_ + lineGap_; }
+	float GetKerning(int32_t leftCodePoint, int32_t rightCodePoint) const; /**   ̿  Դϴ. Ʈ ε   ǥ ȸմϴ. */
 	void MeasureText(const std::wstring& text, float& outWidth, float& outHeight) const;
 
 private:
+	friend class RenderManager2D;
+	friend class TextLayout;
+	friend class TextRun;
+
+	/**  ۸ ĳ Դϴ.  ̴ ۸ η äϴ. */
+	struct Shelf
+	{
+		int32_t y = 0;
+		int32_t height = 0;
+		int32_t cursor = 0; /**  ۸ ġ x ǥԴϴ. */
+		uint64_t lastUseGeneration = 0;
+		std::vector<int32_t> codePoints; /**    ĳÿ  ڵ Ʈ Դϴ. */
+	};
+
+	void LoadMetrics(const stbtt_fontinfo* info, float scale, int32_t beginCodePoint, int32_t endCodePoint);
 	std::shared_ptr<uint8_t[]> CreateGlyphAtlasBitmap(const std::vector<uint8_t>& buffer);
-	uint32_t CreateGlyphAtlasResource(const std::shared_ptr<uint8_t[]>& bitmap);
+	uint32_t CreateGlyphAtlasResource(const uint8_t* bitmap);
+
+	Glyph GetGlyph(int32_t codePoint, uint32_t& outShelf) const; /** ۸ ġ  ε Բ ϴ. */
+	static void AdvanceGeneration() { generation_++; } /** RenderManager2D::End ȣմϴ.  ӱ     ְ ˴ϴ. */
+	bool TouchShelves(const std::vector<uint32_t>& shelves, uint64_t evictionCount) const; /**    ŵ ʾҴٸ ݵ   ǥմϴ. */
+
+	Glyph CacheGlyph(int32_t codePoint) const;
+	uint32_t AllocateShelf(int32_t width, int32_t height) const;
 
 private:
 	float fontSize_ = 0.0f;
@@ -48,6 +107,27 @@ private:
 	int32_t endCodePoint_ = 0;
 	int32_t atlasWidth_ = 0;
 	int32_t atlasHeight_ = 0;
-	std::vector<Glyph> glyphs_;
 	uint32_t atlasID_ = 0;
+
+	float ascent_ = 0.0f;
+	float descent_ = 0.0f;
+	float lineGap_ = 0.0f;
+	std::unordered_map<uint64_t, float> kernings_; /** ( ڵ Ʈ << 32 |  ڵ Ʈ) Ű ϴ Ŀ ǥԴϴ. */
+
+	bool bIsDynamic_ = false;
+	bool bIsSDF_ = false;
+	std::vector<uint8_t> fontBuffer_; /**  ĳÿ ۸ ȭ  ϴ .ttf Դϴ. */
+	std::unique_ptr<stbtt_fontinfo> fontInfo_;
+	float fontScale_ = 0.0f;
+
+	/**  ĳô GetGlyph(const) ŵǹǷ mutableԴϴ. Ŀ  RenderCommandList2D    մϴ. */
+	mutable std::mutex mutex_;
+	mutable std::unordered_map<int32_t, Glyph> glyphs_;
+	mutable std::unordered_map<int32_t, uint32_t> glyphShelves_; /** ڵ Ʈ ġ  εԴϴ. */
+	mutable std::vector<Shelf> shelves_;
+	mutable std::vector<uint8_t> atlasBitmap_; /** Ʋ CPU 纻Դϴ.   Active ȣ  εմϴ. */
+	mutable int32_t dirtyMinY_ = 0;
+	mutable int32_t dirtyMaxY_ = 0;
+	static std::atomic<uint64_t> generation_; /**   Ʈ ϴ  ȣԴϴ. */
+	mutable uint64_t evictionCount_ = 0;
 };
\ No newline at end of file
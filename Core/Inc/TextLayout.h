@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "GameMath.h"
+#include "TTFont.h"
+
+/**
+ *  ʺ     ؽƮ ġ  ĳմϴ.
+ * - 鿡  ,  ܾ ں    ϴ. '\n' ׻  ٲߴϴ.
+ * - ۸  ݿ Ʈ ε   Ŀ մϴ.
+ * - SetText ޺κи ٲ ؽƮ ϸ ٲ ġ Ե   ٺ͸ ٽ ġմϴ.
+ * - ġ  ġ  »̸,  Ʒ (-y) Դϴ.
+ */
+class TextLayout
+{
+public:
+	enum class Align : int32_t
+	{
+		LEFT   = 0x00,
+		CENTER = 0x01,
+		RIGHT  = 0x02,
+	};
+
+public:
+	TextLayout() = default;
+	~TextLayout() {}
+
+	/** boxWidth 0 ̸   ,   ķ մϴ. */
+	void SetFont(TTFont* font, float boxWidth, const Align& align = Align::LEFT);
+	void SetText(const std::wstring& text);
+	void AppendText(const std::wstring& text);
+
+	TTFont* GetFont() const { return font_; }
+	const std::wstring& GetText() const { return text_; }
+	float GetBoxWidth() const { return boxWidth_; }
+	const Align& GetAlign() const { return align_; }
+	const Vec2f& GetSize() const { return size_; } /**    ʺ ü  Դϴ. */
+	uint32_t GetLineCount() const { return static_cast<uint32_t>(lines_.size()); }
+
+private:
+	friend class RenderManager2D;
+
+	struct Line
+	{
+		uint32_t beginIndex = 0; /**  ù  εԴϴ. */
+		uint32_t endIndex = 0; /**   ù  εԴϴ. */
+		uint32_t quadIndex = 0; /**  ù ۸ 簢 εԴϴ. */
+		float width = 0.0f;
+	};
+
+	void Relayout(uint32_t changedIndex);
+	void Refresh(); /**  ۸ ĳ Ʈ ۸ ŵǾٸ ٽ ġմϴ.   ȣմϴ. */
+	uint32_t BreakLine(uint32_t beginIndex, float& outWidth) const;
+	void EmitLine(Line& line);
+
+private:
+	TTFont* font_ = nullptr;
+	float boxWidth_ = 0.0f;
+	Align align_ = Align::LEFT;
+
+	std::wstring text_;
+	std::vector<Line> lines_;
+	std::vector<GlyphQuad> quads_;
+	Vec2f size_;
+
+	std::vector<uint32_t> shelves_; /**  ۸ ĳ Ʈ ۸ ġ  Դϴ. */
+	uint64_t evictionCount_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "GameMath.h"
+#include "TTFont.h"
+
+/**
+ * (Ʈ, ڿ) ֿ  ġ ģ ۸ 簢  ũ⸦ ĳմϴ.
+ * -  Ʈ ڿ Set ٽ ȣϸ ؽø ϰ ٽ ġ ʽϴ.
+ * - RenderManager2D::DrawString ϸ ۸ ȸ   ĳõ 簢  ۷ űϴ.
+ * -  ۸ ĳ Ʈ ۸ ŵǾٸ  ׸  ٽ ġմϴ.
+ */
+class TextRun
+{
+public:
+	TextRun() = default;
+	TextRun(TTFont* font, const std::wstring& text);
+	~TextRun() {}
+
+	void Set(TTFont* font, const std::wstring& text);
+
+	TTFont* GetFont() const { return font_; }
+	const std::wstring& GetText() const { return text_; }
+	const Vec2f& GetSize() const { return size_; } /** TTFont::MeasureText  ϴ. */
+	uint64_t GetHash() const { return hash_; }
+
+	static uint64_t ComputeHash(const TTFont* font, const std::wstring& text);
+
+private:
+	friend class RenderManager2D;
+
+	void Build();
+	void Refresh(); /**  ۸ ĳ Ʈ ۸ ŵǾٸ ٽ ġմϴ.   ȣմϴ. */
+
+private:
+	TTFont* font_ = nullptr;
+	std::wstring text_;
+	uint64_t hash_ = 0;
+	Vec2f size_;
+	std::vector<GlyphQuad> quads_;
+
+	std::vector<uint32_t> shelves_; /**  ۸ ĳ Ʈ ۸ ġ  Դϴ. */
+	uint64_t evictionCount_ = 0; /** ġ  TTFont   ȽԴϴ. */
+};
\ No newline at end of file
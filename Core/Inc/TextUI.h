@@ -2,6 +2,7 @@
 
 #include "Collision2D.h"
 #include "IEntityUI.h"
+#include "TextRun.h"
 
 class TTFont;
 
@@ -35,4 +36,5 @@ private:
 	Layout layout_;
 	Vec2f textSize_;
 	Vec2f textPos_; /**    ؽƮ ġ. */
+	TextRun textRun_; /** ġ  ģ ؽƮԴϴ. ؽƮ ٲ  ٽ ġմϴ. */
 };
\ No newline at end of file
@@ -9,6 +9,7 @@ class Texture2D : public ITexture
 {
 public:
 	Texture2D(const std::string& path, const Filter& filter);
+	Texture2D(int32_t width, int32_t height, int32_t channels, const uint8_t* pixels, const Filter& filter); /** ̹ ڵ ȼ ۷ մϴ. */
 	virtual ~Texture2D();
 
 	DISALLOW_COPY_AND_ASSIGN(Texture2D);
@@ -21,8 +22,16 @@ public:
 	int32_t GetChannels() const { return channels_; }
 	
 private:
+	friend class ResourceManager;
+	friend class TextureArray2D;
+
+	Texture2D() = default; /** 񵿱 εԴϴ. ȼ ۰ εǱ  ʱȭ  Դϴ. */
+
+	void CreateTextureFromPixelBuffer(int32_t width, int32_t height, int32_t channels, const Filter& filter); /** GL_PIXEL_UNPACK_BUFFER ε ¿ ȣؾ մϴ. */
+
 	uint32_t CreateTextureFromImage(const std::string& path, const Filter& filter);
-	uint32_t CreateTextureFromDDS(const std::string& path, const Filter& filter);
+	uint32_t CreateTextureFromTextureFile(const std::string& path, const Filter& filter); /** DDS/KTX2    εմϴ. */
+	uint32_t CreateTextureFromPixels(const uint8_t* pixels, const Filter& filter);
 
 private:
 	int32_t width_ = 0;
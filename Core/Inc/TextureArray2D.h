@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "GameMath.h"
+#include "ITexture.h"
+
+class Texture2D;
+
+/**
+ * -  ũ ̾  2D ؽó 迭(GL_TEXTURE_2D_ARRAY)Դϴ.
+ * - ̾ ũ⺸  ̹ ̾ »ܿ ġ˴ϴ.
+ * - ȼ  RGBA8 Դϴ.
+ */
+class TextureArray2D : public ITexture
+{
+public:
+	TextureArray2D(int32_t width, int32_t height, int32_t maxLayerCount, const Filter& filter);
+	virtual ~TextureArray2D();
+
+	DISALLOW_COPY_AND_ASSIGN(TextureArray2D);
+
+	virtual void Release() override;
+	virtual void Active(uint32_t unit) const override;
+
+	int32_t AddLayer(const std::string& path); /** ̹   ̾ εϰ ̾ ε ȯմϴ. */
+	int32_t Register(const Texture2D* texture); /** RGBA ؽó GPU 󿡼  ̾ ϰ ̾ ε ȯմϴ. */
+	void RemoveLayer(int32_t layer);
+
+	int32_t GetWidth() const { return width_; }
+	int32_t GetHeight() const { return height_; }
+	int32_t GetMaxLayerCount() const { return maxLayerCount_; }
+	const Vec2i& GetLayerSize(int32_t layer) const;
+
+private:
+	int32_t AllocateLayer(int32_t width, int32_t height);
+
+private:
+	int32_t width_ = 0;
+	int32_t height_ = 0;
+	int32_t maxLayerCount_ = 0;
+
+	std::vector<Vec2i> layerSizes_; /** ̾ ġ ̹ ũԴϴ. ũⰡ 0̸  ̾Դϴ. */
+	std::vector<int32_t> freeLayers_;
+
+	uint32_t textureID_ = 0;
+};
\ No newline at end of file
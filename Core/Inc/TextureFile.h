@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+/**
+ * DDS/KTX2 ؽó   Ľϰ    մϴ.
+ * GL ȣ  ޸ ۸ ٷǷ 帮 ȯ濡 ϸ,  ʹ  (ε ) ״ ŵϴ.
+ */
+namespace TextureFile
+{
+
+static const uint32_t MAX_LEVEL_COUNT = 16;
+
+struct Format
+{
+	uint32_t internalFormat = 0;
+	uint32_t format = 0; /**  信 մϴ. */
+	uint32_t type = 0; /**  信 մϴ. */
+	uint32_t channels = 0;
+	uint32_t blockSize = 0; /**   4x4  Ʈ ũ,   ȼ Ʈ ũԴϴ. */
+	bool bIsCompressed = false;
+	const char* extension = nullptr; /** ʿ GL ȮԴϴ. ھ ̸ nullptrԴϴ. */
+};
+
+struct Level
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+	std::size_t offset = 0; /**    Ʈ Դϴ. */
+	std::size_t size = 0;
+};
+
+struct Desc
+{
+	uint32_t width = 0;
+	uint32_t height = 0;
+	Format format;
+	uint32_t levelCount = 0;
+	std::array<Level, MAX_LEVEL_COUNT> levels;
+	bool bGenerateMipmap = false; /** KTX2 levelCount 0̸ Ӹ Ÿӿ ؾ մϴ. */
+};
+
+bool IsTextureFilePath(const std::string& path); /** Ȯڰ dds Ǵ ktx2 Ȯմϴ. */
+bool Parse(const std::string& path, const uint8_t* data, std::size_t size, Desc& outDesc, std::string& outResult); /** Ȯڿ  ParseDDS/ParseKTX2 ȣմϴ. */
+bool ParseDDS(const uint8_t* data, std::size_t size, Desc& outDesc, std::string& outResult);
+bool ParseKTX2(const uint8_t* data, std::size_t size, Desc& outDesc, std::string& outResult);
+
+uint32_t GetFullLevelCount(uint32_t width, uint32_t height);
+std::size_t GetLevelSize(const Format& format, uint32_t width, uint32_t height);
+
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "Macro.h"
+
+class StreamTexture2D;
+
+/** ؽó ƮӴ ̱Դϴ. Ʈ ؽó   ¸ ޸  ȿ մϴ. */
+class TextureStreamer
+{
+public:
+	struct Stats
+	{
+		uint32_t textureCount = 0;
+		uint32_t pendingLoadCount = 0;
+		std::size_t budgetByteSize = 0;
+		std::size_t residentByteSize = 0;
+		std::size_t pendingByteSize = 0;
+		uint64_t loadedLevelCount = 0; /**  Դϴ. */
+		uint64_t evictedLevelCount = 0; /**  Դϴ. */
+	};
+
+public:
+	DISALLOW_COPY_AND_ASSIGN(TextureStreamer);
+
+	static TextureStreamer& GetRef();
+	static TextureStreamer* GetPtr();
+
+	void SetBudget(std::size_t byteSize) { stats_.budgetByteSize = byteSize; }
+	const Stats& GetStats() const { return stats_; }
+	uint64_t GetFrame() const { return frame_; }
+
+	/**
+	 *  忡   ȣϸ, IApp::Run ȣմϴ.
+	 * 簡   εϰ, û       ,  ȿ   ε մϴ.
+	 */
+	void Tick();
+
+private:
+	friend class IApp;
+	friend class StreamTexture2D;
+
+	struct LevelLoad;
+
+	TextureStreamer() = default;
+	virtual ~TextureStreamer() {}
+
+	void Startup(); /** IApp ο ȣؾ մϴ. */
+	void Shutdown(); /** IApp ο ȣؾ մϴ. */
+
+	void Register(StreamTexture2D* texture);
+	void Unregister(StreamTexture2D* texture);
+
+	void CompleteLoads();
+	void UpdateTargets();
+	bool Reclaim(std::size_t byteSize); /**  ȿ byteSize ŭ    ʿ  ϴ. */
+	void StartLoads();
+	void RunWorker();
+
+private:
+	static TextureStreamer instance_;
+	static const std::size_t DEFAULT_BUDGET_BYTE_SIZE = 256 * 1024 * 1024;
+	static const uint32_t MAX_PENDING_LOAD_COUNT = 4;
+
+	Stats stats_;
+	uint64_t frame_ = 0;
+
+	std::vector<StreamTexture2D*> textures_;
+	std::vector<std::shared_ptr<LevelLoad>> loads_; /**  忡 մϴ. */
+
+	std::thread worker_;
+	std::queue<std::shared_ptr<LevelLoad>> jobs_;
+	std::mutex jobMutex_;
+	std::condition_variable jobCondition_;
+	bool bIsStopWorker_ = false;
+};
\ No newline at end of file
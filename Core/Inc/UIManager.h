@@ -18,10 +18,14 @@ public:
 	static UIManager& GetRef();
 	static UIManager* GetPtr();
 
+	/** path ŷ (.cooked)̸ JSON Ľ ʰ ε 信 ̾ƿ нϴ. */
 	ButtonUI* CreateButtonUI(const std::string& path, const Mouse& mouse, TTFont* font, const std::function<void()>& clickEvent);
 	PanelUI* CreatePanelUI(const std::string& path, TTFont* font);
 	TextUI* CreateTextUI(const std::string& path, TTFont* font);
 
+	/** JSON UI ̾ƿ , float  迭, UTF-8 ؽƮ  ̳ʸ ŷմϴ. */
+	static void CookLayout(const std::string& jsonPath, const std::string& outputPath);
+
 	void BatchRenderUIEntity(IEntityUI** entities, uint32_t count);
 	
 private:
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 
 #include "IResource.h"
@@ -9,11 +10,14 @@ class VertexBuffer : public IResource
 public:
 	enum class Usage
 	{
-		STREAM  = 0x88E0,
-		STATIC  = 0x88E4,
-		DYNAMIC = 0x88E8,
+		STREAM     = 0x88E0,
+		STATIC     = 0x88E4,
+		DYNAMIC    = 0x88E8,
+		PERSISTENT = 0xFFFF, /** glBufferStorage  (persistent & coherent)  Դϴ. */
 	};
 
+	static const uint32_t MAX_RING_SEGMENT = 3; /** PERSISTENT    Դϴ. (Ʈ ۸) */
+
 public:
 	VertexBuffer(uint32_t byteSize, const Usage& usage);
 	VertexBuffer(const void* bufferPtr, uint32_t byteSize, const Usage& usage);
@@ -28,8 +32,34 @@ public:
 
 	void SetBufferData(const void* bufferPtr, uint32_t bufferSize);
 
+	uint32_t GetByteSize() const { return byteSize_; }
+
+	/** 
+	 * -  SetBufferData  ġ Ʈ Դϴ.
+	 * - PERSISTENT  ۴   ȿ ̾ ϹǷ,  ũ ׻ (νϽ) ũ  մϴ.
+	 * - PERSISTENT ƴ϶ ׻ 0Դϴ.
+	 */
+	uint32_t GetWriteOffset() const { return writeOffset_; }
+
+	/** 
+	 * -   ϴ ׸  ڿ 潺 ϰ   Ѿϴ.
+	 * - PERSISTENT  ۿ ǹ̰ ,  ׸ ȣ     ȣմϴ.
+	 * -  ߰     SetBufferData  潺 ϰ   Ѿϴ.
+	 */
+	void Fence();
+
+private:
+	void CreatePersistentStorage(const void* bufferPtr);
+	void WaitSegment(uint32_t segment);
+
 private:
 	uint32_t vertexBufferID_ = 0;
 	uint32_t byteSize_ = 0;
 	Usage usage_ = Usage::STATIC;
+
+	uint8_t* mappedBufferPtr_ = nullptr; /** PERSISTENT   ε ּԴϴ. */
+	uint32_t segment_ = 0;
+	uint32_t segmentCursor_ = 0; /**    Ʈ Դϴ. */
+	uint32_t writeOffset_ = 0;
+	std::array<void*, MAX_RING_SEGMENT> fences_ = { nullptr, }; /**  GLsync üԴϴ. */
 };
\ No newline at end of file
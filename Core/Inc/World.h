@@ -0,0 +1,177 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Archetype.h"
+#include "IEntity2D.h"
+
+/**
+ * ŰŸ  ECS Դϴ.
+ * - Ʈ ŰŸԺ SoA 迭 Ǹ, Query ŰŸԸ ӵ 迭 ״ Ѱ ݴϴ.
+ * -  ü 2D ƼƼ̹Ƿ EntityManager ϰ  Ʈ/ Ͽ  ϵ ý ˴ϴ.
+ * - Query/ForEach ߿ ƼƼ Ʈ ߰/  ϴ.
+ */
+class World : public IEntity2D
+{
+public:
+	using System = std::function<void(World&, float)>;
+	using RenderSystem = std::function<void(World&)>;
+
+public:
+	World();
+	virtual ~World();
+
+	DISALLOW_COPY_AND_ASSIGN(World);
+
+	virtual void Tick(float deltaSeconds) override;
+	virtual void Render() override;
+	virtual void Release() override;
+
+	void AddSystem(const System& system) { systems_.push_back(system); }
+	void AddRenderSystem(const RenderSystem& renderSystem) { renderSystems_.push_back(renderSystem); }
+
+	template <typename... TComponents>
+	EntityID CreateEntity(TComponents&&... components)
+	{
+		Archetype* archetype = GetArchetype((static_cast<ComponentMask>(0) | ... | ComponentRegistry::GetMask<std::decay_t<TComponents>>()));
+		EntityID entityID = AllocateEntity();
+		uint32_t row = archetype->AddRow(entityID);
+
+		(new (archetype->GetColumn<std::decay_t<TComponents>>() + row) std::decay_t<TComponents>(std::forward<TComponents>(components)), ...);
+
+		records_[entityID.index].archetype = archetype;
+		records_[entityID.index].row = row;
+
+		return entityID;
+	}
+
+	void DestroyEntity(const EntityID& entityID);
+	bool IsAlive(const EntityID& entityID) const;
+
+	template <typename TComponent>
+	bool HasComponent(const EntityID& entityID) const
+	{
+		return IsAlive(entityID) && records_[entityID.index].archetype->HasComponent(ComponentRegistry::GetID<TComponent>());
+	}
+
+	template <typename TComponent>
+	TComponent* GetComponent(const EntityID& entityID) const
+	{
+		if (!HasComponent<TComponent>(entityID))
+		{
+			return nullptr;
+		}
+
+		const Record& record = records_[entityID.index];
+		return record.archetype->GetColumn<TComponent>() + record.row;
+	}
+
+	/** ̹ Ʈ   ϴ.  ߰ϸ ƼƼ ٸ ŰŸ ̵մϴ. */
+	template <typename TComponent>
+	TComponent* AddComponent(const EntityID& entityID, TComponent&& component)
+	{
+		using TValue = std::decay_t<TComponent>;
+
+		if (TValue* existing = GetComponent<TValue>(entityID))
+		{
+			*existing = std::forward<TComponent>(component);
+			return existing;
+		}
+
+		uint32_t componentID = ComponentRegistry::GetID<TValue>();
+		if (!MoveEntity(entityID, componentID, true))
+		{
+			return nullptr;
+		}
+
+		const Record& record = records_[entityID.index];
+		TValue* ptr = record.archetype->GetColumn<TValue>() + record.row;
+		new (ptr) TValue(std::forward<TComponent>(component));
+
+		return ptr;
+	}
+
+	template <typename TComponent>
+	void RemoveComponent(const EntityID& entityID)
+	{
+		if (HasComponent<TComponent>(entityID))
+		{
+			MoveEntity(entityID, ComponentRegistry::GetID<TComponent>(), false);
+		}
+	}
+
+	/**  Ʈ  ŰŸԸ func(count, columns...) ȣմϴ.  ÷ count ӵ 迭Դϴ. */
+	template <typename... TComponents, typename TFunc>
+	void Query(TFunc&& func)
+	{
+		ComponentMask mask = (static_cast<ComponentMask>(0) | ... | ComponentRegistry::GetMask<TComponents>());
+
+		queryDepth_++;
+		for (auto& archetype : archetypes_)
+		{
+			if ((archetype->GetMask() & mask) == mask && archetype->GetCount() > 0)
+			{
+				func(archetype->GetCount(), archetype->GetColumn<TComponents>()...);
+			}
+		}
+		queryDepth_--;
+	}
+
+	/**  Ʈ  ƼƼ func(entityID, components...) ȣմϴ. */
+	template <typename... TComponents, typename TFunc>
+	void ForEach(TFunc&& func)
+	{
+		ComponentMask mask = (static_cast<ComponentMask>(0) | ... | ComponentRegistry::GetMask<TComponents>());
+
+		queryDepth_++;
+		for (auto& archetype : archetypes_)
+		{
+			if ((archetype->GetMask() & mask) != mask)
+			{
+				continue;
+			}
+
+			const EntityID* entities = archetype->GetEntities();
+			std::tuple<TComponents*...> columns(archetype->GetColumn<TComponents>()...);
+			for (uint32_t row = 0; row < archetype->GetCount(); ++row)
+			{
+				func(entities[row], std::get<TComponents*>(columns)[row]...);
+			}
+		}
+		queryDepth_--;
+	}
+
+	uint32_t GetEntityCount() const { return entityCount_; }
+	uint32_t GetArchetypeCount() const { return static_cast<uint32_t>(archetypes_.size()); }
+
+private:
+	struct Record
+	{
+		Archetype* archetype = nullptr;
+		uint32_t row = 0;
+		uint32_t generation = 0;
+		uint32_t nextFreeIndex = EntityID::INVALID_INDEX; /**  ִ ڵ峢  ħ  ƮԴϴ. */
+	};
+
+	EntityID AllocateEntity();
+	Archetype* GetArchetype(ComponentMask mask);
+	bool MoveEntity(const EntityID& entityID, uint32_t componentID, bool bIsAdd);
+	void UpdateMovedRecord(const EntityID& movedEntityID, uint32_t row);
+
+private:
+	std::vector<std::unique_ptr<Archetype>> archetypes_;
+	std::unordered_map<ComponentMask, Archetype*> archetypeCache_;
+
+	std::vector<Record> records_;
+	uint32_t freeIndex_ = EntityID::INVALID_INDEX;
+	uint32_t entityCount_ = 0;
+	uint32_t queryDepth_ = 0;
+
+	std::vector<System> systems_;
+	std::vector<RenderSystem> renderSystems_;
+};
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include <mimalloc.h>
+
+#include "Archetype.h"
+#include "Assertion.h"
+
+/** ŰŸ ÷ ּҸ  Ƿ Ҵ ʴ  迭 մϴ. */
+static std::array<ComponentInfo, ComponentRegistry::MAX_COMPONENT_TYPE> componentInfos;
+static uint32_t componentCount = 0;
+
+const ComponentInfo& ComponentRegistry::GetInfo(uint32_t componentID)
+{
+	CHECK(componentID < componentCount);
+	return componentInfos[componentID];
+}
+
+uint32_t ComponentRegistry::Register(const ComponentInfo& info)
+{
+	ASSERT(componentCount < MAX_COMPONENT_TYPE, "Component type count exceeds %d.", MAX_COMPONENT_TYPE);
+
+	componentInfos[componentCount] = info;
+	return componentCount++;
+}
+
+Archetype::Archetype(ComponentMask mask)
+	: mask_(mask)
+{
+	columnIndices_.fill(-1);
+	addEdges_.fill(nullptr);
+	removeEdges_.fill(nullptr);
+
+	for (uint32_t componentID = 0; componentID < ComponentRegistry::MAX_COMPONENT_TYPE; ++componentID)
+	{
+		if (mask_ & (static_cast<ComponentMask>(1) << componentID))
+		{
+			Column column;
+			column.componentID = componentID;
+			column.info = &ComponentRegistry::GetInfo(componentID);
+
+			columnIndices_[componentID] = static_cast<int32_t>(columns_.size());
+			columns_.push_back(column);
+		}
+	}
+}
+
+Archetype::~Archetype()
+{
+	uint32_t count = GetCount();
+	for (auto& column : columns_)
+	{
+		for (uint32_t row = 0; row < count; ++row)
+		{
+			column.info->destroy(column.data + row * column.info->size);
+		}
+
+		mi_free(column.data);
+		column.data = nullptr;
+	}
+
+	entities_.clear();
+	capacity_ = 0;
+}
+
+uint32_t Archetype::AddRow(const EntityID& entityID)
+{
+	uint32_t row = GetCount();
+	if (row >= capacity_)
+	{
+		Reserve((capacity_ == 0) ? 64 : capacity_ * 2);
+	}
+
+	entities_.push_back(entityID);
+	return row;
+}
+
+EntityID Archetype::RemoveRow(uint32_t row)
+{
+	CHECK(row < GetCount());
+
+	for (auto& column : columns_)
+	{
+		column.info->destroy(column.data + row * column.info->size);
+	}
+
+	return FillHole(row);
+}
+
+EntityID Archetype::MoveRow(uint32_t row, Archetype* dst, uint32_t& outDstRow)
+{
+	CHECK(row < GetCount() && dst != this);
+
+	outDstRow = dst->AddRow(entities_[row]);
+	for (auto& column : columns_)
+	{
+		uint8_t* src = column.data + row * column.info->size;
+
+		void* dstColumn = dst->GetColumn(column.componentID);
+		if (dstColumn)
+		{
+			column.info->move(reinterpret_cast<uint8_t*>(dstColumn) + outDstRow * column.info->size, src);
+		}
+		else
+		{
+			column.info->destroy(src);
+		}
+	}
+
+	return FillHole(row);
+}
+
+void Archetype::Reserve(uint32_t capacity)
+{
+	uint32_t count = GetCount();
+	for (auto& column : columns_)
+	{
+		std::size_t alignment = (column.info->alignment > COLUMN_ALIGNMENT) ? column.info->alignment : COLUMN_ALIGNMENT;
+		uint8_t* data = reinterpret_cast<uint8_t*>(mi_malloc_aligned(column.info->size * capacity, alignment));
+		CHECK(data != nullptr);
+
+		for (uint32_t row = 0; row < count; ++row)
+		{
+			column.info->move(data + row * column.info->size, column.data + row * column.info->size);
+		}
+
+		mi_free(column.data);
+		column.data = data;
+	}
+
+	entities_.reserve(capacity);
+	capacity_ = capacity;
+}
+
+EntityID Archetype::FillHole(uint32_t row)
+{
+	uint32_t last = GetCount() - 1;
+	if (row == last)
+	{
+		entities_.pop_back();
+		return EntityID();
+	}
+
+	for (auto& column : columns_)
+	{
+		column.info->move(column.data + row * column.info->size, column.data + last * column.info->size);
+	}
+
+	entities_[row] = entities_[last];
+	entities_.pop_back();
+
+	return entities_[row];
+}
\ No newline at end of file
@@ -1,12 +1,220 @@
+#include <algorithm>
+#include <cstring>
+
 #include <json/json.h>
+#include <stb_image.h>
 
 #include "Assertion.h"
 #include "Atlas2D.h"
 #include "GameUtils.h"
-#include "IApp.h"
+#include "MappedFile.h"
+#include "NameID.h"
+
+/** ŷ Ʋ  Դϴ.      Ʈ Դϴ. */
+static const uint32_t COOKED_ATLAS_MAGIC = 0x534C5441; /** 'ATLS' */
+static const uint32_t COOKED_ATLAS_VERSION = 1;
+
+struct CookedAtlasHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	int32_t width;
+	int32_t height;
+	uint32_t blockCount;
+	uint32_t blockOffset;
+	uint32_t uvOffset;
+	uint32_t nameOffset;
+	uint32_t stringOffset;
+	uint32_t stringSize;
+};
+
+/** ̸ ̺ ؽ  ĵǾ ־  Ž SpriteID ãϴ. */
+struct Atlas2D::CookedName
+{
+	uint64_t hash;
+	uint32_t id;
+	uint32_t offset;
+	uint32_t length;
+	uint32_t reserved;
+};
+
+static_assert(sizeof(Atlas2D::Block) == sizeof(int32_t) * 4, "Cooked atlas format relies on a tightly packed block.");
+static_assert(sizeof(std::array<Vec2f, 4>) == sizeof(float) * 8, "Cooked atlas format relies on tightly packed UVs.");
 
-Atlas2D::Atlas2D(const std::string& imagePath, const std::string& jsonPath, const Filter& filter)
+Atlas2D::Atlas2D(const std::string& imagePath, const std::string& layoutPath, const Filter& filter)
 	: Texture2D(imagePath, filter)
+{
+	if (IsCookedPath(layoutPath))
+	{
+		LoadCooked(layoutPath);
+	}
+	else
+	{
+		LoadJson(layoutPath);
+	}
+}
+
+Atlas2D::Atlas2D(int32_t width, int32_t height, const uint8_t* pixels, const std::vector<std::string>& names, const std::vector<Block>& blocks, const Filter& filter)
+	: Texture2D(width, height, 4, pixels, filter)
+{
+	LoadBlocks(names, blocks);
+}
+
+Atlas2D::~Atlas2D()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void Atlas2D::Release()
+{
+	cookedNames_ = nullptr;
+	cookedStrings_ = nullptr;
+	cookedFile_.reset();
+
+	Texture2D::Release();
+}
+
+void Atlas2D::Cook(const std::string& imagePath, const std::string& jsonPath, const std::string& outputPath)
+{
+	int32_t atlasWidth = 0;
+	int32_t atlasHeight = 0;
+	int32_t channels = 0;
+	ASSERT(stbi_info(imagePath.c_str(), &atlasWidth, &atlasHeight, &channels), "Failed to read '%s' image info.", imagePath.c_str());
+
+	std::vector<std::string> keys;
+	std::vector<Block> blocks;
+	ParseJson(jsonPath, keys, blocks);
+
+	WriteCooked(outputPath, atlasWidth, atlasHeight, keys, blocks);
+}
+
+bool Atlas2D::IsCookedPath(const std::string& path)
+{
+	return GameUtils::ToLower(GameUtils::GetFileExtension(path)) == "cooked";
+}
+
+const std::vector<std::string>& Atlas2D::GetKeys() const
+{
+	if (cookedFile_ && keys_.empty())
+	{
+		keys_.resize(blockCount_);
+		for (uint32_t index = 0; index < blockCount_; ++index)
+		{
+			const CookedName& name = cookedNames_[index];
+			keys_[name.id] = std::string(cookedStrings_ + name.offset, name.length);
+		}
+	}
+
+	return keys_;
+}
+
+const Atlas2D::Block& Atlas2D::GetByName(const std::string& name) const
+{
+	SpriteID id = Find(name);
+	CHECK(id != INVALID_SPRITE_ID);
+
+	return blocks_[id];
+}
+
+Atlas2D::SpriteID Atlas2D::Find(const std::string& name) const
+{
+	if (!cookedFile_)
+	{
+		auto it = spriteIDs_.find(name);
+		if (it == spriteIDs_.end())
+		{
+			return INVALID_SPRITE_ID;
+		}
+
+		return it->second;
+	}
+
+	uint64_t hash = NameID::Hash(name.data(), name.size());
+	const CookedName* end = cookedNames_ + blockCount_;
+	const CookedName* it = std::lower_bound(cookedNames_, end, hash, [](const CookedName& l, uint64_t r) { return l.hash < r; });
+
+	for (; it != end && it->hash == hash; ++it)
+	{
+		if (it->length == name.size() && std::memcmp(cookedStrings_ + it->offset, name.data(), name.size()) == 0)
+		{
+			return it->id;
+		}
+	}
+
+	return INVALID_SPRITE_ID;
+}
+
+std::array<Vec2f, 4> Atlas2D::ComputeUVs(const Block& block, int32_t atlasWidth, int32_t atlasHeight)
+{
+	float width = static_cast<float>(atlasWidth);
+	float height = static_cast<float>(atlasHeight);
+
+	float x0 = static_cast<float>(block.pos.x) / width;
+	float y0 = static_cast<float>(block.pos.y) / height;
+	float x1 = static_cast<float>(block.pos.x + block.size.x) / width;
+	float y1 = static_cast<float>(block.pos.y + block.size.y) / height;
+
+	std::array<Vec2f, 4> uvs =
+	{
+		Vec2f(x0, y1),
+		Vec2f(x1, y1),
+		Vec2f(x1, y0),
+		Vec2f(x0, y0),
+	};
+
+	return uvs;
+}
+
+void Atlas2D::WriteCooked(const std::string& outputPath, int32_t atlasWidth, int32_t atlasHeight, const std::vector<std::string>& names, const std::vector<Block>& blocks)
+{
+	std::vector<std::array<Vec2f, 4>> uvs(blocks.size());
+	for (uint32_t index = 0; index < blocks.size(); ++index)
+	{
+		uvs[index] = ComputeUVs(blocks[index], atlasWidth, atlasHeight);
+	}
+
+	std::vector<CookedName> cookedNames(names.size());
+	std::string strings;
+	for (uint32_t index = 0; index < names.size(); ++index)
+	{
+		cookedNames[index].hash = NameID::Hash(names[index].data(), names[index].size());
+		cookedNames[index].id = index;
+		cookedNames[index].offset = static_cast<uint32_t>(strings.size());
+		cookedNames[index].length = static_cast<uint32_t>(names[index].size());
+		cookedNames[index].reserved = 0;
+
+		strings += names[index];
+		strings.push_back('\0');
+	}
+
+	std::sort(cookedNames.begin(), cookedNames.end(), [](const CookedName& l, const CookedName& r) { return l.hash < r.hash; });
+
+	CookedAtlasHeader header;
+	header.magic = COOKED_ATLAS_MAGIC;
+	header.version = COOKED_ATLAS_VERSION;
+	header.width = atlasWidth;
+	header.height = atlasHeight;
+	header.blockCount = static_cast<uint32_t>(blocks.size());
+	header.blockOffset = sizeof(CookedAtlasHeader);
+	header.uvOffset = header.blockOffset + static_cast<uint32_t>(blocks.size() * sizeof(Block));
+	header.nameOffset = header.uvOffset + static_cast<uint32_t>(uvs.size() * sizeof(std::array<Vec2f, 4>));
+	header.stringOffset = header.nameOffset + static_cast<uint32_t>(cookedNames.size() * sizeof(CookedName));
+	header.stringSize = static_cast<uint32_t>(strings.size());
+
+	std::vector<uint8_t> buffer(header.stringOffset + header.stringSize);
+	std::memcpy(buffer.data(), &header, sizeof(CookedAtlasHeader));
+	std::memcpy(buffer.data() + header.blockOffset, blocks.data(), blocks.size() * sizeof(Block));
+	std::memcpy(buffer.data() + header.uvOffset, uvs.data(), uvs.size() * sizeof(std::array<Vec2f, 4>));
+	std::memcpy(buffer.data() + header.nameOffset, cookedNames.data(), cookedNames.size() * sizeof(CookedName));
+	std::memcpy(buffer.data() + header.stringOffset, strings.data(), strings.size());
+
+	GameUtils::WriteFile(outputPath, buffer);
+}
+
+void Atlas2D::ParseJson(const std::string& jsonPath, std::vector<std::string>& outKeys, std::vector<Block>& outBlocks)
 {
 	std::vector<uint8_t> buffer = GameUtils::ReadFile(jsonPath);
 	std::string jsonString(buffer.begin(), buffer.end());
@@ -30,28 +238,60 @@ Atlas2D::Atlas2D(const std::string& imagePath, const std::string& jsonPath, cons
 		block.size.x = element["w"].asInt();
 		block.size.y = element["h"].asInt();
 
-		keys_.push_back(key.c_str());
-		blocks_.insert({ key.c_str(), block });
+		outKeys.push_back(key.c_str());
+		outBlocks.push_back(block);
 	}
 }
 
-Atlas2D::~Atlas2D()
+void Atlas2D::LoadJson(const std::string& jsonPath)
 {
-	if (bIsInitialized_)
-	{
-		Release();
-	}
+	std::vector<std::string> keys;
+	std::vector<Block> blocks;
+	ParseJson(jsonPath, keys, blocks);
+
+	LoadBlocks(keys, blocks);
 }
 
-void Atlas2D::Release()
+void Atlas2D::LoadBlocks(const std::vector<std::string>& names, const std::vector<Block>& blocks)
 {
-	Texture2D::Release();
+	CHECK(names.size() == blocks.size());
+
+	keys_ = names;
+	blockStorage_ = blocks;
+	uvStorage_.resize(blocks.size());
+
+	for (uint32_t index = 0; index < blocks.size(); ++index)
+	{
+		uvStorage_[index] = ComputeUVs(blocks[index], GetWidth(), GetHeight());
+		spriteIDs_.insert({ names[index], static_cast<SpriteID>(index) });
+	}
+
+	blocks_ = blockStorage_.data();
+	uvs_ = uvStorage_.data();
+	blockCount_ = static_cast<uint32_t>(blockStorage_.size());
 }
 
-const Atlas2D::Block& Atlas2D::GetByName(const std::string& name) const
+void Atlas2D::LoadCooked(const std::string& cookedPath)
 {
-	auto it = blocks_.find(name);
-	CHECK(it != blocks_.end());
+	cookedFile_ = std::make_unique<MappedFile>(cookedPath);
+
+	const CookedAtlasHeader* header = cookedFile_->GetPtr<CookedAtlasHeader>(0);
+	ASSERT(header != nullptr && header->magic == COOKED_ATLAS_MAGIC, "Invalid cooked atlas '%s' file.", cookedPath.c_str());
+	ASSERT(header->version == COOKED_ATLAS_VERSION, "Unsupported cooked atlas version %d in '%s' file.", header->version, cookedPath.c_str());
+	ASSERT(header->width == GetWidth() && header->height == GetHeight(), "Cooked atlas '%s' does not match its image size.", cookedPath.c_str());
 
-	return it->second;
+	blockCount_ = header->blockCount;
+	blocks_ = cookedFile_->GetPtr<Block>(header->blockOffset, blockCount_);
+	uvs_ = cookedFile_->GetPtr<std::array<Vec2f, 4>>(header->uvOffset, blockCount_);
+	cookedNames_ = cookedFile_->GetPtr<CookedName>(header->nameOffset, blockCount_);
+	cookedStrings_ = cookedFile_->GetPtr<char>(header->stringOffset, header->stringSize);
+	ASSERT(blocks_ && uvs_ && cookedNames_ && cookedStrings_, "Truncated cooked atlas '%s' file.", cookedPath.c_str());
+
+	/** GetKeys Find ̸ ׸ ˻  ϹǷ, ε     Ȯմϴ. */
+	for (uint32_t index = 0; index < blockCount_; ++index)
+	{
+		const CookedName& name = cookedNames_[index];
+		ASSERT(static_cast<uint64_t>(name.offset) + static_cast<uint64_t>(name.length) <= header->stringSize, "Invalid sprite name range in cooked atlas '%s' file.", cookedPath.c_str());
+		ASSERT(name.id < blockCount_, "Invalid sprite id %u in cooked atlas '%s' file.", name.id, cookedPath.c_str());
+	}
 }
\ No newline at end of file
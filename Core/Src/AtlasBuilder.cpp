@@ -0,0 +1,209 @@
+#include <algorithm>
+
+#include <stb_image.h>
+#include <stb_image_write.h>
+#include <stb_rect_pack.h>
+
+#include "Assertion.h"
+#include "AtlasBuilder.h"
+#include "GameUtils.h"
+#include "ResourceManager.h"
+
+AtlasBuilder::AtlasBuilder(int32_t pageSize, int32_t padding, int32_t extrude)
+	: pageSize_(pageSize)
+	, padding_(padding)
+	, extrude_(extrude)
+{
+	CHECK(pageSize_ > 0 && padding_ >= 0 && extrude_ >= 0);
+}
+
+void AtlasBuilder::Add(const std::string& name, const std::string& path)
+{
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+	uint8_t* imagePtr = stbi_load(path.c_str(), &width, &height, &channels, CHANNELS);
+	ASSERT(imagePtr != nullptr, "failed to load %s file", path.c_str());
+
+	Add(name, width, height, CHANNELS, imagePtr);
+
+	stbi_image_free(imagePtr);
+	imagePtr = nullptr;
+}
+
+void AtlasBuilder::Add(const std::string& name, int32_t width, int32_t height, int32_t channels, const uint8_t* pixels)
+{
+	CHECK(width > 0 && height > 0 && 1 <= channels && channels <= CHANNELS && pixels != nullptr);
+
+	int32_t border = 2 * extrude_ + padding_;
+	ASSERT(width + border <= pageSize_ && height + border <= pageSize_, "'%s' image does not fit in %d page size.", name.c_str(), pageSize_);
+
+	Image image;
+	image.name = name;
+	image.width = width;
+	image.height = height;
+	image.pixels.resize(static_cast<std::size_t>(width * height * CHANNELS));
+
+	for (int32_t index = 0; index < width * height; ++index)
+	{
+		const uint8_t* src = pixels + index * channels;
+		uint8_t* dst = image.pixels.data() + index * CHANNELS;
+
+		switch (channels)
+		{
+		case 1: /** ȸ */
+			dst[0] = dst[1] = dst[2] = src[0];
+			dst[3] = 0xFF;
+			break;
+
+		case 2: /** ȸ +  */
+			dst[0] = dst[1] = dst[2] = src[0];
+			dst[3] = src[1];
+			break;
+
+		case 3:
+			dst[0] = src[0];
+			dst[1] = src[1];
+			dst[2] = src[2];
+			dst[3] = 0xFF;
+			break;
+
+		default:
+			dst[0] = src[0];
+			dst[1] = src[1];
+			dst[2] = src[2];
+			dst[3] = src[3];
+			break;
+		}
+	}
+
+	images_.push_back(std::move(image));
+}
+
+void AtlasBuilder::Clear()
+{
+	images_.clear();
+}
+
+std::vector<Atlas2D*> AtlasBuilder::Build(const Texture2D::Filter& filter) const
+{
+	std::vector<Page> pages;
+	Pack(pages);
+
+	std::vector<Atlas2D*> atlases;
+	for (const auto& page : pages)
+	{
+		Atlas2D* atlas = ResourceManager::GetRef().Create<Atlas2D>(page.width, page.height, page.pixels.data(), page.names, page.blocks, filter);
+		CHECK(atlas != nullptr);
+
+		atlases.push_back(atlas);
+	}
+
+	return atlases;
+}
+
+void AtlasBuilder::Cook(const std::string& basePath) const
+{
+	std::vector<Page> pages;
+	Pack(pages);
+
+	for (uint32_t index = 0; index < pages.size(); ++index)
+	{
+		const Page& page = pages[index];
+		std::string imagePath = GameUtils::PrintF("%s_%d.png", basePath.c_str(), index);
+		std::string cookedPath = GameUtils::PrintF("%s_%d.cooked", basePath.c_str(), index);
+
+		int32_t bSucceed = stbi_write_png(imagePath.c_str(), page.width, page.height, CHANNELS, page.pixels.data(), page.width * CHANNELS);
+		ASSERT(bSucceed, "Failed to write '%s' file.", imagePath.c_str());
+
+		Atlas2D::WriteCooked(cookedPath, page.width, page.height, page.names, page.blocks);
+	}
+}
+
+void AtlasBuilder::Pack(std::vector<Page>& outPages) const
+{
+	int32_t border = 2 * extrude_ + padding_;
+
+	std::vector<stbrp_rect> pending(images_.size());
+	for (uint32_t index = 0; index < images_.size(); ++index)
+	{
+		pending[index].id = static_cast<int32_t>(index);
+		pending[index].w = images_[index].width + border;
+		pending[index].h = images_[index].height + border;
+		pending[index].x = 0;
+		pending[index].y = 0;
+		pending[index].was_packed = 0;
+	}
+
+	std::vector<stbrp_node> nodes(pageSize_);
+	std::vector<stbrp_rect> remain;
+
+	while (!pending.empty())
+	{
+		stbrp_context context;
+		stbrp_init_target(&context, pageSize_, pageSize_, nodes.data(), static_cast<int32_t>(nodes.size()));
+		stbrp_pack_rects(&context, pending.data(), static_cast<int32_t>(pending.size()));
+
+		Page page;
+		page.width = pageSize_;
+		page.height = pageSize_;
+		page.pixels.resize(static_cast<std::size_t>(pageSize_ * pageSize_ * CHANNELS), 0);
+
+		int32_t usedHeight = 0;
+		remain.clear();
+
+		for (const auto& rect : pending)
+		{
+			if (!rect.was_packed)
+			{
+				remain.push_back(rect);
+				continue;
+			}
+
+			Blit(images_[rect.id], rect.x, rect.y, page);
+			usedHeight = std::max<int32_t>(usedHeight, rect.y + rect.h);
+		}
+
+		CHECK(!page.blocks.empty());
+
+		/**  ʴ Ʒ  2 ŵ ̱ ߶  ޸𸮸 Դϴ. */
+		int32_t height = 1;
+		while (height < usedHeight)
+		{
+			height <<= 1;
+		}
+
+		page.height = std::min<int32_t>(height, pageSize_);
+		page.pixels.resize(static_cast<std::size_t>(page.width * page.height * CHANNELS));
+
+		outPages.push_back(std::move(page));
+		pending.swap(remain);
+	}
+}
+
+void AtlasBuilder::Blit(const Image& image, int32_t x, int32_t y, Page& outPage) const
+{
+	int32_t baseX = x + extrude_;
+	int32_t baseY = y + extrude_;
+
+	for (int32_t dy = -extrude_; dy < image.height + extrude_; ++dy)
+	{
+		int32_t srcY = std::clamp<int32_t>(dy, 0, image.height - 1);
+
+		for (int32_t dx = -extrude_; dx < image.width + extrude_; ++dx)
+		{
+			int32_t srcX = std::clamp<int32_t>(dx, 0, image.width - 1);
+
+			const uint8_t* src = image.pixels.data() + (srcY * image.width + srcX) * CHANNELS;
+			uint8_t* dst = outPage.pixels.data() + ((baseY + dy) * outPage.width + (baseX + dx)) * CHANNELS;
+			std::copy(src, src + CHANNELS, dst);
+		}
+	}
+
+	Atlas2D::Block block;
+	block.pos = Vec2i(baseX, baseY);
+	block.size = Vec2i(image.width, image.height);
+
+	outPage.names.push_back(image.name);
+	outPage.blocks.push_back(block);
+}
\ No newline at end of file
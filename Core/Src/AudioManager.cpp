@@ -1,4 +1,5 @@
 #include <array>
+#include <cstring>
 
 #include <mimalloc.h>
 #include <miniaudio.h>
@@ -58,7 +59,7 @@ void AudioManager::Startup()
 	allocationCallbacks.onFree = AudioFree;
 
 	ma_engine_config config;
-	ZeroMemory(&config, sizeof(ma_engine_config));
+	std::memset(&config, 0, sizeof(ma_engine_config));
 
 	config.allocationCallbacks = allocationCallbacks;
 
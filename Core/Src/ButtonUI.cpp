@@ -23,8 +23,8 @@ ButtonUI::ButtonUI(const Layout& layout, const std::function<void()>& clickEvent
 
 	bound_ = Rect2D(layout_.center, layout_.size);
 
-	Vec2f textSize;
-	layout_.font->MeasureText(layout_.text, textSize.x, textSize.y);
+	textRun_.Set(layout_.font, layout_.text);
+	const Vec2f& textSize = textRun_.GetSize();
 
 	textPos_ = layout_.center + Vec2f(-textSize.x * 0.5f, +textSize.y * 0.5f);
 	stateColors_ =
@@ -1,4 +1,5 @@
 #include <array>
+#include <cfloat>
 
 #include "Assertion.h"
 #include "Collision2D.h"
@@ -1,7 +1,11 @@
+#if defined(_WIN32)
 #include <windows.h>
 #include <dbghelp.h>
 #include <pathcch.h>
 #include <Shlwapi.h>
+#else
+#include <csignal>
+#endif
 
 #include "Assertion.h"
 #include "CrashManager.h"
@@ -13,6 +17,7 @@ CrashManager CrashManager::instance_;
 static std::function<void()> crashCallbackEvent_ = nullptr;
 static std::wstring crashDumpFile_;
 
+#if defined(_WIN32)
 std::wstring GetCrashDumpPath()
 {
 	static wchar_t exePath[MAX_PATH];
@@ -55,6 +60,20 @@ LONG WINAPI DetectApplicationCrash(EXCEPTION_POINTERS* ep)
 
 	return EXCEPTION_EXECUTE_HANDLER;
 }
+#else
+/** Windows ̿ ÷ ̴   ʰ, ũ ݹ鸸 ȣ  ⺻ ó ٽ ñ׳ ϴ. */
+void DetectApplicationCrash(int32_t signal)
+{
+	std::signal(signal, SIG_DFL);
+
+	if (crashCallbackEvent_)
+	{
+		crashCallbackEvent_();
+	}
+
+	std::raise(signal);
+}
+#endif
 
 CrashManager& CrashManager::GetRef()
 {
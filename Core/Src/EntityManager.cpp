@@ -1,7 +1,12 @@
+#include <algorithm>
+
+#include <mimalloc.h>
+
 #include "Assertion.h"
 #include "EntityManager.h"
 
 EntityManager EntityManager::instance_;
+uint32_t EntityManager::poolTypeCount_ = 0;
 
 EntityManager& EntityManager::GetRef()
 {
@@ -15,84 +20,126 @@ EntityManager* EntityManager::GetPtr()
 
 void EntityManager::Destroy(const IEntity* entity)
 {
-	int32_t entityID = -1;
-	for (uint32_t index = 0; index < size_; ++index)
+	if (!IsManaged(entity))
 	{
-		IEntity* entityPtr = entities_[index].get();
-		if (entity == entityPtr)
-		{
-			entityID = static_cast<int32_t>(index);
-			break;
-		}
+		return;
 	}
 
-	if (entityID != -1 && entities_[entityID])
+	EntityBlock* block = entity->entityBlock_;
+	IEntity* entityPtr = block->entity;
+
+	if (block->nameCount > 0) /** κ ƼƼ ̸ Ƿ ̸ ǥ ǳʶݴϴ. */
 	{
-		Unregister(entity);
+		Unregister(entityPtr);
+	}
 
-		if (entities_[entityID]->IsInitialized())
-		{
-			entities_[entityID]->Release();
-		}
+	if (entityPtr->IsInitialized())
+	{
+		entityPtr->Release();
+	}
 
-		entities_[entityID].reset();
-		usage_[entityID] = false;
+	entityPtr->~IEntity();
+	block->pool->Free(block);
+	entityCount_--;
+}
+
+void EntityManager::Register(const NameID& name, IEntity* entity)
+{
+	bool bIsInserted = entityCache_.Insert(name, entity);
+	ASSERT(bIsInserted, "Already register name(0x%016llX)", static_cast<unsigned long long>(name.GetHash()));
+
+	if (IsManaged(entity))
+	{
+		entityNames_[entity].push_back(name);
+		entity->entityBlock_->nameCount++;
 	}
 }
 
-void EntityManager::Register(const std::string& name, IEntity* entity)
+bool EntityManager::IsRegistration(const NameID& name)
 {
-	auto it = entityCache_.find(name);
-	ASSERT(it == entityCache_.end(), "Already register '%s'", name.c_str());
+	return entityCache_.Contains(name);
+}
+
+void EntityManager::Unregister(const NameID& name)
+{
+	IEntity** entityPtr = entityCache_.Find(name);
+	ASSERT(entityPtr != nullptr, "Can't find name(0x%016llX) in EntityManager.", static_cast<unsigned long long>(name.GetHash()));
 
-	entityCache_.insert({ name, entity });
+	IEntity* entity = *entityPtr;
+	if (IsManaged(entity))
+	{
+		std::vector<NameID>& names = entityNames_.at(entity);
+		names.erase(std::find(names.begin(), names.end(), name));
+		if (names.empty())
+		{
+			entityNames_.erase(entity);
+		}
+
+		entity->entityBlock_->nameCount--;
+	}
+
+	entityCache_.Erase(name);
 }
 
-bool EntityManager::IsRegistration(const std::string& name)
+bool EntityManager::IsManaged(const IEntity* entity) const
 {
-	return entityCache_.find(name) != entityCache_.end();
+	return entity && entity->entityBlock_ && entity->entityBlock_->entity == entity;
 }
 
-void EntityManager::Unregister(const std::string& name)
+EntityPool* EntityManager::CreatePool(uint32_t poolIndex, std::size_t entityByteSize)
 {
-	auto it = entityCache_.find(name);
-	ASSERT(it != entityCache_.end(), "Can't find '%s' in EntityManager.", name.c_str());
+	if (poolIndex >= pools_.size())
+	{
+		pools_.resize(poolIndex + 1);
+	}
+
+	CHECK(!pools_[poolIndex]);
+
+	if (!heap_)
+	{
+		heap_ = mi_heap_new();
+		CHECK(heap_ != nullptr);
+	}
 
-	entityCache_.erase(it);
+	pools_[poolIndex] = std::make_unique<EntityPool>(heap_, entityByteSize);
+	return pools_[poolIndex].get();
 }
 
 void EntityManager::Unregister(const IEntity* entity)
 {
-	std::string name;
-	for (const auto& entityCache : entityCache_)
+	auto it = entityNames_.find(entity);
+	if (it == entityNames_.end())
 	{
-		if (entityCache.second == entity)
-		{
-			name = entityCache.first;
-		}
+		return;
 	}
 
-	if (!name.empty())
+	for (const auto& name : it->second)
 	{
-		Unregister(name);
+		entityCache_.Erase(name);
 	}
+
+	entityNames_.erase(it);
+	entity->entityBlock_->nameCount = 0;
 }
 
 void EntityManager::Cleanup()
 {
-	for (std::size_t index = 0; index < size_; ++index)
+	for (auto& pool : pools_)
 	{
-		if (entities_[index])
+		if (pool)
 		{
-			if (entities_[index]->IsInitialized())
-			{
-				entities_[index]->Release();
-			}
-
-			entities_[index].reset();
-			usage_[index] = false;
+			pool->Cleanup();
 		}
 	}
 
-	size_ = 0;
+	pools_.clear();
+	entityCount_ = 0;
+	entityCache_.Clear();
+	entityNames_.clear();
+
+	if (heap_)
+	{
+		mi_heap_destroy(reinterpret_cast<mi_heap_t*>(heap_));
+		heap_ = nullptr;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include <new>
+
+#include <mimalloc.h>
+
+#include "Assertion.h"
+#include "EntityPool.h"
+#include "IEntity.h"
+
+EntityPool::EntityPool(void* heap, std::size_t entityByteSize)
+	: heap_(heap)
+{
+	storageByteSize_ = (entityByteSize + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+	blockCountPerChunk_ = static_cast<uint32_t>(CHUNK_BYTE_SIZE / (storageByteSize_ + sizeof(EntityBlock)));
+	if (blockCountPerChunk_ == 0)
+	{
+		blockCountPerChunk_ = 1;
+	}
+}
+
+EntityPool::~EntityPool()
+{
+	Cleanup();
+
+	for (auto& chunk : chunks_)
+	{
+		for (uint32_t index = 0; index < blockCountPerChunk_; ++index)
+		{
+			GetBlock(chunk, index)->~EntityBlock();
+		}
+
+		mi_free(chunk);
+	}
+
+	chunks_.clear();
+	freeBlock_ = nullptr;
+}
+
+void EntityPool::Cleanup()
+{
+	for (auto& chunk : chunks_)
+	{
+		for (uint32_t index = 0; index < blockCountPerChunk_; ++index)
+		{
+			EntityBlock* block = GetBlock(chunk, index);
+
+			IEntity* entity = block->entity;
+			if (!entity)
+			{
+				continue;
+			}
+
+			if (entity->IsInitialized())
+			{
+				entity->Release();
+			}
+
+			entity->~IEntity();
+			Free(block);
+		}
+	}
+}
+
+void EntityPool::AllocateChunk()
+{
+	std::size_t chunkByteSize = (storageByteSize_ + sizeof(EntityBlock)) * blockCountPerChunk_;
+	uint8_t* chunk = reinterpret_cast<uint8_t*>(mi_heap_malloc_aligned(reinterpret_cast<mi_heap_t*>(heap_), chunkByteSize, BLOCK_ALIGNMENT));
+	CHECK(chunk != nullptr);
+
+	chunks_.push_back(chunk);
+
+	/** ּҰ  Ϻ Ҵǵ   Ʈ մϴ. */
+	for (uint32_t index = blockCountPerChunk_; index > 0; --index)
+	{
+		EntityBlock* block = new (GetBlock(chunk, index - 1)) EntityBlock();
+		block->pool = this;
+		block->storage = chunk + (index - 1) * storageByteSize_;
+		block->nextFreeBlock = freeBlock_;
+		freeBlock_ = block;
+	}
+}
\ No newline at end of file
@@ -1,4 +1,8 @@
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#include <ctime>
+#endif
 
 #include <SDL2/SDL.h>
 
@@ -116,6 +120,7 @@ void GameTimer::Tick()
 
 void GameTimer::GetCurrentSystemTime(int32_t& outYear, int32_t& outMonth, int32_t& outDay, int32_t& outHour, int32_t& outMinute, int32_t& outSecond)
 {
+#if defined(_WIN32)
 	SYSTEMTIME systemTime;
 	GetLocalTime(&systemTime);
 
@@ -125,6 +130,18 @@ void GameTimer::GetCurrentSystemTime(int32_t& outYear, int32_t& outMonth, int32_
 	outHour = static_cast<int32_t>(systemTime.wHour);
 	outMinute = static_cast<int32_t>(systemTime.wMinute);
 	outSecond = static_cast<int32_t>(systemTime.wSecond);
+#else
+	std::time_t currentTime = std::time(nullptr);
+	std::tm systemTime;
+	localtime_r(&currentTime, &systemTime);
+
+	outYear = static_cast<int32_t>(systemTime.tm_year + 1900);
+	outMonth = static_cast<int32_t>(systemTime.tm_mon + 1);
+	outDay = static_cast<int32_t>(systemTime.tm_mday);
+	outHour = static_cast<int32_t>(systemTime.tm_hour);
+	outMinute = static_cast<int32_t>(systemTime.tm_min);
+	outSecond = static_cast<int32_t>(systemTime.tm_sec);
+#endif
 }
 
 std::string GameTimer::GetCurrentSystemTimeAsString()
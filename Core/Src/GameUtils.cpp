@@ -1,6 +1,17 @@
 #include <algorithm>
+#include <cctype>
+#include <cwctype>
+
+#if defined(_WIN32)
 #include <Shlwapi.h>
 #include <windows.h>
+#else
+#include <cerrno>
+#include <climits>
+#include <cwchar>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "Assertion.h"
 #include "GameUtils.h"
@@ -23,7 +34,11 @@ std::wstring GameUtils::PrintF(const wchar_t* format, ...)
 {
 	va_list args;
 	va_start(args, format);
+#if defined(_WIN32)
 	int32_t size = _vsnwprintf_s(wcharBuffer_, MAX_STRING_BUFFER_SIZE, format, args);
+#else
+	int32_t size = std::vswprintf(wcharBuffer_, MAX_STRING_BUFFER_SIZE, format, args);
+#endif
 	va_end(args);
 
 	return std::wstring(wcharBuffer_, size);
@@ -76,28 +91,28 @@ std::string GameUtils::Convert(const std::wstring& text)
 std::string GameUtils::ToLower(const std::string& text)
 {
 	std::string lower = text;
-	std::transform(lower.begin(), lower.end(), lower.begin(), std::tolower);
+	std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
 	return lower;
 }
 
 std::wstring GameUtils::ToLower(const std::wstring& text)
 {
 	std::wstring lower = text;
-	std::transform(lower.begin(), lower.end(), lower.begin(), std::tolower);
+	std::transform(lower.begin(), lower.end(), lower.begin(), [](wchar_t c) { return static_cast<wchar_t>(std::towlower(c)); });
 	return lower;
 }
 
 std::string GameUtils::ToUpper(const std::string& text)
 {
 	std::string upper = text;
-	std::transform(upper.begin(), upper.end(), upper.begin(), std::toupper);
+	std::transform(upper.begin(), upper.end(), upper.begin(), [](char c) { return static_cast<char>(std::toupper(static_cast<unsigned char>(c))); });
 	return upper;
 }
 
 std::wstring GameUtils::ToUpper(const std::wstring& text)
 {
 	std::wstring upper = text;
-	std::transform(upper.begin(), upper.end(), upper.begin(), std::toupper);
+	std::transform(upper.begin(), upper.end(), upper.begin(), [](wchar_t c) { return static_cast<wchar_t>(std::towupper(c)); });
 	return upper;
 }
 
@@ -163,6 +178,7 @@ bool GameUtils::ToFloat(const std::wstring& floating, float& outFloating)
 	return true;
 }
 
+#if defined(_WIN32)
 std::vector<uint8_t> GameUtils::ReadFile(const std::string& path)
 {
 	HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
@@ -232,6 +248,62 @@ bool GameUtils::IsValidPath(const std::wstring& path)
 {
 	return PathFileExistsW(path.c_str());
 }
+#else
+std::vector<uint8_t> GameUtils::ReadFile(const std::string& path)
+{
+	FILE* file = std::fopen(path.c_str(), "rb");
+	ASSERT(file != nullptr, "%s", std::strerror(errno));
+
+	std::fseek(file, 0, SEEK_END);
+	long fileSize = std::ftell(file);
+	std::fseek(file, 0, SEEK_SET);
+
+	std::vector<uint8_t> buffer(static_cast<std::size_t>(fileSize));
+	ASSERT(std::fread(buffer.data(), 1, buffer.size(), file) == buffer.size(), "%s", std::strerror(errno));
+	ASSERT(std::fclose(file) == 0, "%s", std::strerror(errno));
+
+	return buffer;
+}
+
+std::vector<uint8_t> GameUtils::ReadFile(const std::wstring& path)
+{
+	return ReadFile(Convert(path));
+}
+
+void GameUtils::WriteFile(const std::string& path, const std::vector<uint8_t>& buffer)
+{
+	FILE* file = std::fopen(path.c_str(), "wb");
+	ASSERT(file != nullptr, "%s", std::strerror(errno));
+
+	ASSERT(std::fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size(), "%s", std::strerror(errno));
+	ASSERT(std::fclose(file) == 0, "failed to close %s", std::strerror(errno));
+}
+
+void GameUtils::WriteFile(const std::wstring& path, const std::vector<uint8_t>& buffer)
+{
+	WriteFile(Convert(path), buffer);
+}
+
+void GameUtils::MakeDirectory(const std::string& path)
+{
+	ASSERT(::mkdir(path.c_str(), 0755) == 0, "%s", std::strerror(errno));
+}
+
+void GameUtils::MakeDirectory(const std::wstring& path)
+{
+	MakeDirectory(Convert(path));
+}
+
+bool GameUtils::IsValidPath(const std::string& path)
+{
+	return ::access(path.c_str(), F_OK) == 0;
+}
+
+bool GameUtils::IsValidPath(const std::wstring& path)
+{
+	return IsValidPath(Convert(path));
+}
+#endif
 
 std::string GameUtils::GetBasePath(const std::string& path)
 {
@@ -1,6 +1,11 @@
 #include <algorithm>
 #include <map>
+
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#include <csignal>
+#endif
 
 /**  Ƽ ̺귯      */
 #include <imgui.h>
@@ -24,54 +29,96 @@
 #include "IApp.h"
 #include "IGameScene.h"
 #include "InputManager.h"
+#include "JobSystem.h"
 #include "RenderManager2D.h"
 #include "RenderManager3D.h"
 #include "RenderStateManager.h"
 #include "ResourceManager.h"
+#include "TextureStreamer.h"
 #include "UIManager.h"
 
+#if defined(_WIN32)
 static LPTOP_LEVEL_EXCEPTION_FILTER topLevelExceptionFilter_;
 extern LONG WINAPI DetectApplicationCrash(EXCEPTION_POINTERS* ep);
+#else
+static const int32_t CRASH_SIGNALS[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+extern void DetectApplicationCrash(int32_t signal);
+#endif
 
 IApp* IApp::instance_ = nullptr;
 
-IApp::IApp(const char* title, int32_t x, int32_t y, int32_t w, int32_t h, bool bIsResizble, bool bIsFullscreen)
+IApp::IApp(const char* title, int32_t x, int32_t y, int32_t w, int32_t h, bool bIsResizble, bool bIsFullscreen, bool bIsHeadless)
+	: bIsHeadless_(bIsHeadless)
 {
+#if defined(_WIN32)
 	topLevelExceptionFilter_ = ::SetUnhandledExceptionFilter(DetectApplicationCrash);
+#else
+	for (const auto& signal : CRASH_SIGNALS)
+	{
+		std::signal(signal, DetectApplicationCrash);
+	}
+#endif
 	instance_ = this;
 
 	ASSERT(SDL_SetMemoryFunctions(mi_malloc, mi_calloc, mi_realloc, mi_free) == 0, "%s", SDL_GetError());
-	ASSERT(SDL_Init(SDL_INIT_EVERYTHING) == 0, "%s", SDL_GetError());
 
-	RenderStateManager::GetRef().PreStartup();
-	CreateAppWindow(title, x, y, w, h, bIsResizble, bIsFullscreen);
-	RenderStateManager::GetRef().PostStartup();
+	if (bIsHeadless_)
+	{
+		ASSERT(SDL_Init(SDL_INIT_TIMER | SDL_INIT_EVENTS) == 0, "%s", SDL_GetError());
+		RenderStateManager::GetRef().HeadlessStartup(w, h);
+	}
+	else
+	{
+		ASSERT(SDL_Init(SDL_INIT_EVERYTHING) == 0, "%s", SDL_GetError());
+
+		RenderStateManager::GetRef().PreStartup();
+		CreateAppWindow(title, x, y, w, h, bIsResizble, bIsFullscreen);
+		RenderStateManager::GetRef().PostStartup();
 
-	AudioManager::GetRef().Startup();
+		AudioManager::GetRef().Startup();
+	}
+
+	JobSystem::GetRef().Startup();
 	RenderManager2D::GetRef().Startup();
 	RenderManager3D::GetRef().Startup();
 	DebugDrawManager3D::GetRef().Startup();
 	UIManager::GetRef().Startup();
 	InputManager::GetRef().Startup();
+	TextureStreamer::GetRef().Startup();
 }
 
 IApp::~IApp()
 {
+	JobSystem::GetRef().Shutdown();
 	UIManager::GetRef().Shutdown();
 	EntityManager::GetRef().Cleanup();
 	DebugDrawManager3D::GetRef().Shutdown();
 	RenderManager3D::GetRef().Shutdown();
 	RenderManager2D::GetRef().Shutdown();
 	ResourceManager::GetRef().Cleanup();
-	AudioManager::GetRef().Shutdown();
+	TextureStreamer::GetRef().Shutdown();
+	if (!bIsHeadless_)
+	{
+		AudioManager::GetRef().Shutdown();
+	}
 	RenderStateManager::GetRef().Shutdown();
 
-	SDL_DestroyWindow(reinterpret_cast<SDL_Window*>(window_));
-	window_ = nullptr;
+	if (!bIsHeadless_)
+	{
+		SDL_DestroyWindow(reinterpret_cast<SDL_Window*>(window_));
+		window_ = nullptr;
+	}
 
 	SDL_Quit();
 
+#if defined(_WIN32)
 	::SetUnhandledExceptionFilter(topLevelExceptionFilter_);
+#else
+	for (const auto& signal : CRASH_SIGNALS)
+	{
+		std::signal(signal, SIG_DFL);
+	}
+#endif
 }
 
 void IApp::Run()
@@ -79,6 +126,10 @@ void IApp::Run()
 	GameTimer timer;
 
 	InputManager& inputMgr = InputManager::GetRef();
+	RenderManager2D& render2dMgr = RenderManager2D::GetRef();
+	ResourceManager& resourceMgr = ResourceManager::GetRef();
+	TextureStreamer& textureStreamer = TextureStreamer::GetRef();
+	JobSystem& jobSystem = JobSystem::GetRef();
 	
 	timer.Reset();
 	currentScene_->Enter();
@@ -95,10 +146,17 @@ void IApp::Run()
 			inputMgr.UpdateMouseState();
 
 			timer.Tick();
+			render2dMgr.ResetStats();
+			resourceMgr.UploadAsyncTextures();
+			textureStreamer.Tick();
+			jobSystem.RunMainThreadJobs();
 
-			ImGui_ImplOpenGL3_NewFrame();
-			ImGui_ImplSDL2_NewFrame();
-			ImGui::NewFrame();
+			if (!bIsHeadless_)
+			{
+				ImGui_ImplOpenGL3_NewFrame();
+				ImGui_ImplSDL2_NewFrame();
+				ImGui::NewFrame();
+			}
 
 			currentScene_->Tick(timer.GetDeltaSeconds());
 			currentScene_->Render();
@@ -113,20 +171,16 @@ void IApp::Run()
 	}
 }
 
-void IApp::AddSceneByName(const std::string& name, IGameScene* scene)
+void IApp::AddSceneByName(const NameID& name, IGameScene* scene)
 {
-	auto it = scenes_.find(name);
-	ASSERT(it == scenes_.end(), "Already add '%s'", name.c_str());
-
-	scenes_.insert({ name, scene });
+	bool bIsInserted = scenes_.Insert(name, scene);
+	ASSERT(bIsInserted, "Already add name(0x%016llX)", static_cast<unsigned long long>(name.GetHash()));
 }
 
-void IApp::DeleteScenesByName(const std::string& name)
+void IApp::DeleteScenesByName(const NameID& name)
 {
-	auto it = scenes_.find(name);
-	ASSERT(it != scenes_.end(), "Can't find '%s'.", name.c_str());
-
-	scenes_.erase(it);
+	bool bIsErased = scenes_.Erase(name);
+	ASSERT(bIsErased, "Can't find name(0x%016llX).", static_cast<unsigned long long>(name.GetHash()));
 }
 
 IApp* IApp::Get()
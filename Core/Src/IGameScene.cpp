@@ -0,0 +1,38 @@
+#include "IEntity.h"
+#include "IGameScene.h"
+#include "JobSystem.h"
+
+void IGameScene::ParallelTickEntities(const std::vector<IEntity*>& entities, float deltaSeconds, std::vector<IEntity*>& parallelEntities)
+{
+	static const uint32_t BATCH_SIZE = 64;
+
+	parallelEntities.clear();
+	for (auto& entity : entities)
+	{
+		if (entity->IsThreadSafe())
+		{
+			parallelEntities.push_back(entity);
+		}
+	}
+
+	JobSystem& jobSystem = JobSystem::GetRef();
+	JobCounter counter;
+	jobSystem.ParallelFor(static_cast<uint32_t>(parallelEntities.size()), BATCH_SIZE, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				parallelEntities[index]->Tick(deltaSeconds);
+			}
+		},
+		&counter
+	);
+	jobSystem.Wait(&counter);
+
+	for (auto& entity : entities)
+	{
+		if (!entity->IsThreadSafe())
+		{
+			entity->Tick(deltaSeconds);
+		}
+	}
+}
\ No newline at end of file
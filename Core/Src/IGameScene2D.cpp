@@ -40,6 +40,16 @@ void IGameScene2D::Tick(float deltaSeconds)
 	}
 }
 
+void IGameScene2D::ParallelTick(float deltaSeconds)
+{
+	ParallelTickEntities(updateEntities_, deltaSeconds, parallelEntities_);
+
+	for (auto& uiEntity : uiEntities_)
+	{
+		uiEntity->Tick(deltaSeconds);
+	}
+}
+
 void IGameScene2D::Render()
 {
 	renderStateMgr_->BeginFrame(0.0f, 0.0f, 0.0f, 1.0f);
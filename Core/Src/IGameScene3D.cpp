@@ -35,12 +35,28 @@ void IGameScene3D::Tick(float deltaSeconds)
 {
 	for (auto& updateEntity : updateEntities_)
 	{
-		updateEntity.second->Tick(deltaSeconds);
+		updateEntity.value->Tick(deltaSeconds);
 	}
 
 	for (auto& uiEntity : uiEntities_)
 	{
-		uiEntity.second->Tick(deltaSeconds);
+		uiEntity.value->Tick(deltaSeconds);
+	}
+}
+
+void IGameScene3D::ParallelTick(float deltaSeconds)
+{
+	tickEntities_.clear();
+	for (auto& updateEntity : updateEntities_)
+	{
+		tickEntities_.push_back(updateEntity.value);
+	}
+
+	ParallelTickEntities(tickEntities_, deltaSeconds, parallelEntities_);
+
+	for (auto& uiEntity : uiEntities_)
+	{
+		uiEntity.value->Tick(deltaSeconds);
 	}
 }
 
@@ -5,6 +5,7 @@
 
 #include "Assertion.h"
 #include "InputManager.h"
+#include "RenderStateManager.h"
 
 InputManager InputManager::instance_;
 
@@ -148,7 +149,10 @@ void InputManager::ProcessPollingEvent(void* eventPtr)
 {
 	SDL_Event* e = reinterpret_cast<SDL_Event*>(eventPtr);
 
-	ImGui_ImplSDL2_ProcessEvent(e);
+	if (!RenderStateManager::GetRef().IsHeadless())
+	{
+		ImGui_ImplSDL2_ProcessEvent(e);
+	}
 
 	if (e->type == SDL_QUIT)
 	{
@@ -0,0 +1,302 @@
+#include "Assertion.h"
+#include "JobSystem.h"
+
+JobSystem JobSystem::instance_;
+
+/**  尡   εԴϴ. Ŀ ƴ  0  մϴ. */
+static thread_local uint32_t currentQueueIndex = 0;
+
+bool JobCounter::IsDone() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return count_.load(std::memory_order_acquire) == 0;
+}
+
+JobSystem& JobSystem::GetRef()
+{
+	return instance_;
+}
+
+JobSystem* JobSystem::GetPtr()
+{
+	return &instance_;
+}
+
+void JobSystem::Schedule(const Job& job, JobCounter* counter)
+{
+	Schedule(job, counter, nullptr);
+}
+
+void JobSystem::Schedule(const Job& job, JobCounter* counter, JobCounter* dependency)
+{
+	if (counter)
+	{
+		counter->count_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (!dependency || !AddContinuation(dependency, job, counter, false))
+	{
+		Push(Entry{ job, counter });
+	}
+}
+
+void JobSystem::ScheduleMainThread(const Job& job, JobCounter* counter)
+{
+	ScheduleMainThread(job, counter, nullptr);
+}
+
+void JobSystem::ScheduleMainThread(const Job& job, JobCounter* counter, JobCounter* dependency)
+{
+	if (counter)
+	{
+		counter->count_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (!dependency || !AddContinuation(dependency, job, counter, true))
+	{
+		PushMainThread(Entry{ job, counter });
+	}
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const RangeJob& job, JobCounter* counter)
+{
+	batchSize = (batchSize == 0) ? 1 : batchSize;
+
+	for (uint32_t begin = 0; begin < count; begin += batchSize)
+	{
+		uint32_t end = (count - begin < batchSize) ? count : begin + batchSize;
+		Schedule([job, begin, end]() { job(begin, end); }, counter);
+	}
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const RangeJob& job)
+{
+	JobCounter counter;
+	ParallelFor(count, batchSize, job, &counter);
+	Wait(&counter);
+}
+
+void JobSystem::Wait(JobCounter* counter)
+{
+	bool bIsMainThread = IsMainThread();
+
+	while (!counter->IsDone())
+	{
+		if (TryRunOne())
+		{
+			continue;
+		}
+
+		if (bIsMainThread)
+		{
+			RunMainThreadJobs();
+		}
+
+		std::this_thread::yield();
+	}
+}
+
+void JobSystem::RunMainThreadJobs()
+{
+	CHECK(IsMainThread());
+
+	/** ۾ ȿ ٽ Wait ȣ  Ƿ     Ӵϴ. */
+	std::vector<Entry> entries;
+	{
+		std::lock_guard<std::mutex> lock(mainThreadMutex_);
+		entries.swap(mainThreadEntries_);
+	}
+
+	for (auto& entry : entries)
+	{
+		Execute(entry);
+	}
+}
+
+void JobSystem::Startup()
+{
+	mainThreadID_ = std::this_thread::get_id();
+	bIsQuit_.store(false);
+
+	uint32_t hardwareThreadCount = std::thread::hardware_concurrency();
+	uint32_t workerCount = (hardwareThreadCount > 1) ? hardwareThreadCount - 1 : 1;
+
+	for (uint32_t index = 0; index <= workerCount; ++index)
+	{
+		queues_.push_back(std::make_unique<Queue>());
+	}
+
+	for (uint32_t index = 1; index <= workerCount; ++index)
+	{
+		workers_.emplace_back([this, index]() { WorkerLoop(index); });
+	}
+}
+
+void JobSystem::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(wakeMutex_);
+		bIsQuit_.store(true);
+	}
+	wakeCondition_.notify_all();
+
+	for (auto& worker : workers_)
+	{
+		worker.join();
+	}
+	workers_.clear();
+
+	queues_.clear();
+	pendingCount_.store(0);
+
+	std::lock_guard<std::mutex> lock(mainThreadMutex_);
+	mainThreadEntries_.clear();
+}
+
+void JobSystem::Push(Entry&& entry)
+{
+	uint32_t queueIndex = (currentQueueIndex < queues_.size()) ? currentQueueIndex : 0;
+	Queue& queue = *queues_[queueIndex];
+
+	/**  ֱ  ÷    ٿ  Ǵ  ϴ. */
+	pendingCount_.fetch_add(1, std::memory_order_release);
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		queue.entries.push_back(std::move(entry));
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(wakeMutex_);
+	}
+	wakeCondition_.notify_one();
+}
+
+void JobSystem::PushMainThread(Entry&& entry)
+{
+	std::lock_guard<std::mutex> lock(mainThreadMutex_);
+	mainThreadEntries_.push_back(std::move(entry));
+}
+
+bool JobSystem::AddContinuation(JobCounter* dependency, const Job& job, JobCounter* counter, bool bIsMainThread)
+{
+	std::lock_guard<std::mutex> lock(dependency->mutex_);
+	if (dependency->count_.load(std::memory_order_acquire) == 0)
+	{
+		return false;
+	}
+
+	JobCounter::Continuation continuation;
+	continuation.job = job;
+	continuation.counter = counter;
+	continuation.bIsMainThread = bIsMainThread;
+
+	dependency->continuations_.push_back(continuation);
+	return true;
+}
+
+bool JobSystem::TryPop(Entry& outEntry)
+{
+	if (pendingCount_.load(std::memory_order_acquire) == 0)
+	{
+		return false;
+	}
+
+	uint32_t queueCount = static_cast<uint32_t>(queues_.size());
+	uint32_t queueIndex = (currentQueueIndex < queueCount) ? currentQueueIndex : 0;
+
+	{
+		Queue& queue = *queues_[queueIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.entries.empty())
+		{
+			outEntry = std::move(queue.entries.back());
+			queue.entries.pop_back();
+			pendingCount_.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	for (uint32_t offset = 1; offset < queueCount; ++offset)
+	{
+		Queue& queue = *queues_[(queueIndex + offset) % queueCount];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.entries.empty())
+		{
+			outEntry = std::move(queue.entries.front());
+			queue.entries.pop_front();
+			pendingCount_.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool JobSystem::TryRunOne()
+{
+	Entry entry;
+	if (!TryPop(entry))
+	{
+		return false;
+	}
+
+	Execute(entry);
+	return true;
+}
+
+void JobSystem::Execute(Entry& entry)
+{
+	entry.job();
+	Finish(entry.counter);
+}
+
+void JobSystem::Finish(JobCounter* counter)
+{
+	if (!counter)
+	{
+		return;
+	}
+
+	/** IsDone   ȿ ٿ, ٸ  ī͸ ı ڿ ϴ  ϴ. */
+	std::vector<JobCounter::Continuation> continuations;
+	{
+		std::lock_guard<std::mutex> lock(counter->mutex_);
+		if (counter->count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			continuations.swap(counter->continuations_);
+		}
+	}
+
+	for (auto& continuation : continuations)
+	{
+		if (continuation.bIsMainThread)
+		{
+			PushMainThread(Entry{ continuation.job, continuation.counter });
+		}
+		else
+		{
+			Push(Entry{ continuation.job, continuation.counter });
+		}
+	}
+}
+
+void JobSystem::WorkerLoop(uint32_t queueIndex)
+{
+	currentQueueIndex = queueIndex;
+
+	while (true)
+	{
+		if (TryRunOne())
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(wakeMutex_);
+		wakeCondition_.wait(lock, [&]() { return bIsQuit_.load() || pendingCount_.load() > 0; });
+
+		if (bIsQuit_.load())
+		{
+			break;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Assertion.h"
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+MappedFile::MappedFile(const std::string& path)
+{
+	HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	ASSERT(file != INVALID_HANDLE_VALUE, "Failed to open '%s' file.", path.c_str());
+
+	LARGE_INTEGER fileSize;
+	ASSERT(::GetFileSizeEx(file, &fileSize), "Failed to get size of '%s' file.", path.c_str());
+
+	file_ = file;
+	size_ = static_cast<std::size_t>(fileSize.QuadPart);
+	if (size_ == 0)
+	{
+		return;
+	}
+
+	HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	ASSERT(mapping != nullptr, "Failed to create file mapping of '%s' file.", path.c_str());
+
+	mapping_ = mapping;
+	data_ = reinterpret_cast<const uint8_t*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	ASSERT(data_ != nullptr, "Failed to map view of '%s' file.", path.c_str());
+}
+
+MappedFile::~MappedFile()
+{
+	if (data_)
+	{
+		::UnmapViewOfFile(data_);
+		data_ = nullptr;
+	}
+
+	if (mapping_)
+	{
+		::CloseHandle(reinterpret_cast<HANDLE>(mapping_));
+		mapping_ = nullptr;
+	}
+
+	if (file_)
+	{
+		::CloseHandle(reinterpret_cast<HANDLE>(file_));
+		file_ = nullptr;
+	}
+}
+#else
+MappedFile::MappedFile(const std::string& path)
+{
+	int file = ::open(path.c_str(), O_RDONLY);
+	ASSERT(file != -1, "Failed to open '%s' file.", path.c_str());
+
+	struct stat fileStat;
+	ASSERT(::fstat(file, &fileStat) == 0, "Failed to get size of '%s' file.", path.c_str());
+
+	size_ = static_cast<std::size_t>(fileStat.st_size);
+	if (size_ > 0)
+	{
+		void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+		ASSERT(data != MAP_FAILED, "Failed to map view of '%s' file.", path.c_str());
+
+		data_ = (data != MAP_FAILED) ? reinterpret_cast<const uint8_t*>(data) : nullptr;
+	}
+
+	/**   ũ͸ ݾƵ ǹǷ file_, mapping_  ʽϴ. */
+	::close(file);
+}
+
+MappedFile::~MappedFile()
+{
+	if (data_)
+	{
+		::munmap(const_cast<uint8_t*>(data_), size_);
+		data_ = nullptr;
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,616 @@
+#include <map>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "NullGL.h"
+
+static NullGL::Stats stats;
+static GLuint objectID = 0;
+static uintptr_t syncID = 0;
+static GLint viewport[4] = { 0, 0, 0, 0 };
+static std::map<GLenum, GLuint> boundBuffers;
+static std::map<GLuint, std::vector<uint8_t>> bufferStorages;
+
+static uint64_t GetPixelByteSize(GLenum format, GLenum type)
+{
+	uint64_t channel = 4;
+	switch (format)
+	{
+	case GL_RED:
+		channel = 1;
+		break;
+
+	case GL_RG:
+		channel = 2;
+		break;
+
+	case GL_RGB:
+		channel = 3;
+		break;
+	}
+
+	return (type == GL_FLOAT) ? channel * sizeof(float) : channel;
+}
+
+static std::vector<uint8_t>& GetBoundBufferStorage(GLenum target)
+{
+	return bufferStorages[boundBuffers[target]];
+}
+
+static void GenObjects(GLsizei n, GLuint* objects)
+{
+	stats.callCount++;
+	for (GLsizei index = 0; index < n; ++index)
+	{
+		objects[index] = ++objectID;
+	}
+}
+
+static void APIENTRY NullGenBuffers(GLsizei n, GLuint* buffers)
+{
+	GenObjects(n, buffers);
+}
+
+static void APIENTRY NullGenTextures(GLsizei n, GLuint* textures)
+{
+	GenObjects(n, textures);
+}
+
+static void APIENTRY NullGenVertexArrays(GLsizei n, GLuint* arrays)
+{
+	GenObjects(n, arrays);
+}
+
+static GLuint APIENTRY NullCreateShader(GLenum type)
+{
+	stats.callCount++;
+	return ++objectID;
+}
+
+static GLuint APIENTRY NullCreateProgram(void)
+{
+	stats.callCount++;
+	return ++objectID;
+}
+
+static void APIENTRY NullBindBuffer(GLenum target, GLuint buffer)
+{
+	stats.callCount++;
+	boundBuffers[target] = buffer;
+}
+
+static void APIENTRY NullDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+	stats.callCount++;
+	for (GLsizei index = 0; index < n; ++index)
+	{
+		bufferStorages.erase(buffers[index]);
+	}
+}
+
+static void APIENTRY NullBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+	stats.callCount++;
+	stats.bufferAllocateByteSize += static_cast<uint64_t>(size);
+	stats.bufferUploadByteSize += (data != nullptr) ? static_cast<uint64_t>(size) : 0;
+
+	GetBoundBufferStorage(target).resize(static_cast<std::size_t>(size));
+}
+
+static void APIENTRY NullBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)
+{
+	stats.callCount++;
+	stats.bufferAllocateByteSize += static_cast<uint64_t>(size);
+	stats.bufferUploadByteSize += (data != nullptr) ? static_cast<uint64_t>(size) : 0;
+
+	GetBoundBufferStorage(target).resize(static_cast<std::size_t>(size));
+}
+
+static void APIENTRY NullBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+{
+	stats.callCount++;
+	stats.bufferUploadByteSize += static_cast<uint64_t>(size);
+}
+
+static void* APIENTRY NullMapBuffer(GLenum target, GLenum access)
+{
+	stats.callCount++;
+	return GetBoundBufferStorage(target).data();
+}
+
+static void* APIENTRY NullMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	stats.callCount++;
+	return GetBoundBufferStorage(target).data() + offset;
+}
+
+static GLboolean APIENTRY NullUnmapBuffer(GLenum target)
+{
+	stats.callCount++;
+	return GL_TRUE;
+}
+
+static void APIENTRY NullDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	stats.callCount++;
+	stats.drawCallCount++;
+	stats.vertexCount += static_cast<uint64_t>(count);
+}
+
+static void APIENTRY NullDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
+{
+	stats.callCount++;
+	stats.drawCallCount++;
+	stats.vertexCount += static_cast<uint64_t>(count) * static_cast<uint64_t>(instancecount);
+}
+
+static void APIENTRY NullDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex)
+{
+	stats.callCount++;
+	stats.drawCallCount++;
+	stats.vertexCount += static_cast<uint64_t>(count);
+}
+
+static void APIENTRY NullTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels)
+{
+	stats.callCount++;
+	bool bHasPixels = (pixels != nullptr) || (boundBuffers[GL_PIXEL_UNPACK_BUFFER] != 0);
+	stats.textureUploadByteSize += bHasPixels ? static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * GetPixelByteSize(format, type) : 0;
+}
+
+static void APIENTRY NullTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
+{
+	stats.callCount++;
+	stats.textureUploadByteSize += static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * GetPixelByteSize(format, type);
+}
+
+static void APIENTRY NullCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data)
+{
+	stats.callCount++;
+	stats.textureUploadByteSize += static_cast<uint64_t>(imageSize);
+}
+
+static void APIENTRY NullTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels)
+{
+	stats.callCount++;
+	stats.textureUploadByteSize += static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * static_cast<uint64_t>(depth) * GetPixelByteSize(format, type);
+}
+
+static GLsync APIENTRY NullFenceSync(GLenum condition, GLbitfield flags)
+{
+	stats.callCount++;
+	return reinterpret_cast<GLsync>(++syncID);
+}
+
+static GLenum APIENTRY NullClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	stats.callCount++;
+	return GL_ALREADY_SIGNALED;
+}
+
+static GLenum APIENTRY NullGetError(void)
+{
+	return GL_NO_ERROR; /** GL_CHECK ȣǹǷ ȣ Ƚ  ʽϴ. */
+}
+
+static void APIENTRY NullViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	stats.callCount++;
+	viewport[0] = x;
+	viewport[1] = y;
+	viewport[2] = width;
+	viewport[3] = height;
+}
+
+static void APIENTRY NullGetIntegerv(GLenum pname, GLint* data)
+{
+	stats.callCount++;
+	switch (pname)
+	{
+	case GL_VIEWPORT:
+		data[0] = viewport[0];
+		data[1] = viewport[1];
+		data[2] = viewport[2];
+		data[3] = viewport[3];
+		break;
+
+	case GL_MAX_ARRAY_TEXTURE_LAYERS:
+		*data = 2048;
+		break;
+
+	default:
+		*data = 0;
+		break;
+	}
+}
+
+static void APIENTRY NullGetBooleanv(GLenum pname, GLboolean* data)
+{
+	stats.callCount++;
+	*data = GL_FALSE;
+}
+
+static void APIENTRY NullGetShaderiv(GLuint shader, GLenum pname, GLint* params)
+{
+	stats.callCount++;
+	*params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+}
+
+static void APIENTRY NullGetProgramiv(GLuint program, GLenum pname, GLint* params)
+{
+	stats.callCount++;
+	*params = (pname == GL_LINK_STATUS) ? GL_TRUE : 0;
+}
+
+static void APIENTRY NullGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+	stats.callCount++;
+	if (bufSize > 0)
+	{
+		infoLog[0] = '\0';
+	}
+}
+
+static void APIENTRY NullGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+	stats.callCount++;
+	if (bufSize > 0)
+	{
+		infoLog[0] = '\0';
+	}
+}
+
+static const GLubyte* APIENTRY NullGetStringi(GLenum name, GLuint index)
+{
+	stats.callCount++;
+	return reinterpret_cast<const GLubyte*>("");
+}
+
+static GLint APIENTRY NullGetUniformLocation(GLuint program, const GLchar* name)
+{
+	stats.callCount++;
+	return 0;
+}
+
+static void APIENTRY NullActiveTexture(GLenum texture)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullAttachShader(GLuint program, GLuint shader)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullBindTexture(GLenum target, GLuint texture)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullBindVertexArray(GLuint array)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullClear(GLbitfield mask)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullClearDepth(GLdouble depth)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullClearStencil(GLint s)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullCompileShader(GLuint shader)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullDeleteProgram(GLuint program)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullDeleteShader(GLuint shader)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullDeleteSync(GLsync sync)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullDeleteTextures(GLsizei n, const GLuint* textures)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullDisable(GLenum cap)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullEnable(GLenum cap)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullEnableVertexAttribArray(GLuint index)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullGenerateMipmap(GLenum target)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullLinkProgram(GLuint program)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullPixelStorei(GLenum pname, GLint param)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform1f(GLint location, GLfloat v0)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform1fv(GLint location, GLsizei count, const GLfloat* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform1i(GLint location, GLint v0)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform1iv(GLint location, GLsizei count, const GLint* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform2fv(GLint location, GLsizei count, const GLfloat* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform2i(GLint location, GLint v0, GLint v1)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform2iv(GLint location, GLsizei count, const GLint* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform3fv(GLint location, GLsizei count, const GLfloat* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform3iv(GLint location, GLsizei count, const GLint* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform4fv(GLint location, GLsizei count, const GLfloat* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniform4iv(GLint location, GLsizei count, const GLint* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullUseProgram(GLuint program)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer)
+{
+	stats.callCount++;
+}
+
+static void APIENTRY NullVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)
+{
+	stats.callCount++;
+}
+
+void NullGL::Load()
+{
+	glad_glActiveTexture = NullActiveTexture;
+	glad_glAttachShader = NullAttachShader;
+	glad_glBindBuffer = NullBindBuffer;
+	glad_glBindBufferBase = NullBindBufferBase;
+	glad_glBindTexture = NullBindTexture;
+	glad_glBindVertexArray = NullBindVertexArray;
+	glad_glBlendFuncSeparate = NullBlendFuncSeparate;
+	glad_glBufferData = NullBufferData;
+	glad_glBufferStorage = NullBufferStorage;
+	glad_glBufferSubData = NullBufferSubData;
+	glad_glClear = NullClear;
+	glad_glClearColor = NullClearColor;
+	glad_glClearDepth = NullClearDepth;
+	glad_glClearStencil = NullClearStencil;
+	glad_glClientWaitSync = NullClientWaitSync;
+	glad_glCompileShader = NullCompileShader;
+	glad_glCompressedTexImage2D = NullCompressedTexImage2D;
+	glad_glCopyImageSubData = NullCopyImageSubData;
+	glad_glCreateProgram = NullCreateProgram;
+	glad_glCreateShader = NullCreateShader;
+	glad_glDeleteBuffers = NullDeleteBuffers;
+	glad_glDeleteProgram = NullDeleteProgram;
+	glad_glDeleteShader = NullDeleteShader;
+	glad_glDeleteSync = NullDeleteSync;
+	glad_glDeleteTextures = NullDeleteTextures;
+	glad_glDeleteVertexArrays = NullDeleteVertexArrays;
+	glad_glDisable = NullDisable;
+	glad_glDrawArrays = NullDrawArrays;
+	glad_glDrawArraysInstancedBaseInstance = NullDrawArraysInstancedBaseInstance;
+	glad_glDrawElementsBaseVertex = NullDrawElementsBaseVertex;
+	glad_glEnable = NullEnable;
+	glad_glEnableVertexAttribArray = NullEnableVertexAttribArray;
+	glad_glFenceSync = NullFenceSync;
+	glad_glGenBuffers = NullGenBuffers;
+	glad_glGenTextures = NullGenTextures;
+	glad_glGenVertexArrays = NullGenVertexArrays;
+	glad_glGenerateMipmap = NullGenerateMipmap;
+	glad_glGetBooleanv = NullGetBooleanv;
+	glad_glGetError = NullGetError;
+	glad_glGetIntegerv = NullGetIntegerv;
+	glad_glGetProgramInfoLog = NullGetProgramInfoLog;
+	glad_glGetProgramiv = NullGetProgramiv;
+	glad_glGetShaderInfoLog = NullGetShaderInfoLog;
+	glad_glGetShaderiv = NullGetShaderiv;
+	glad_glGetStringi = NullGetStringi;
+	glad_glGetUniformLocation = NullGetUniformLocation;
+	glad_glLinkProgram = NullLinkProgram;
+	glad_glMapBuffer = NullMapBuffer;
+	glad_glMapBufferRange = NullMapBufferRange;
+	glad_glPixelStorei = NullPixelStorei;
+	glad_glShaderSource = NullShaderSource;
+	glad_glTexImage2D = NullTexImage2D;
+	glad_glTexParameteri = NullTexParameteri;
+	glad_glTexStorage3D = NullTexStorage3D;
+	glad_glTexSubImage2D = NullTexSubImage2D;
+	glad_glTexSubImage3D = NullTexSubImage3D;
+	glad_glUniform1f = NullUniform1f;
+	glad_glUniform1fv = NullUniform1fv;
+	glad_glUniform1i = NullUniform1i;
+	glad_glUniform1iv = NullUniform1iv;
+	glad_glUniform2f = NullUniform2f;
+	glad_glUniform2fv = NullUniform2fv;
+	glad_glUniform2i = NullUniform2i;
+	glad_glUniform2iv = NullUniform2iv;
+	glad_glUniform3f = NullUniform3f;
+	glad_glUniform3fv = NullUniform3fv;
+	glad_glUniform3i = NullUniform3i;
+	glad_glUniform3iv = NullUniform3iv;
+	glad_glUniform4f = NullUniform4f;
+	glad_glUniform4fv = NullUniform4fv;
+	glad_glUniform4i = NullUniform4i;
+	glad_glUniform4iv = NullUniform4iv;
+	glad_glUniformMatrix2fv = NullUniformMatrix2fv;
+	glad_glUniformMatrix3fv = NullUniformMatrix3fv;
+	glad_glUniformMatrix4fv = NullUniformMatrix4fv;
+	glad_glUnmapBuffer = NullUnmapBuffer;
+	glad_glUseProgram = NullUseProgram;
+	glad_glVertexAttribDivisor = NullVertexAttribDivisor;
+	glad_glVertexAttribIPointer = NullVertexAttribIPointer;
+	glad_glVertexAttribPointer = NullVertexAttribPointer;
+	glad_glViewport = NullViewport;
+
+	ResetStats();
+}
+
+const NullGL::Stats& NullGL::GetStats()
+{
+	return stats;
+}
+
+void NullGL::ResetStats()
+{
+	stats = NullGL::Stats();
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "Assertion.h"
+#include "RenderCommandList2D.h"
+
+void RenderCommandList2D::Begin(const Camera2D* camera)
+{
+	CHECK(!bIsRecording_);
+	CHECK(RenderManager2D::recordingList_ == nullptr);
+
+	items_.clear();
+	vertices_.clear();
+	sortLayer_ = 0;
+	stats_ = RenderManager2D::Stats();
+	RenderManager2D::SetCullBounds(camera, bHasCullBounds_, cullMinPos_, cullMaxPos_);
+
+	RenderManager2D::recordingList_ = this;
+	bIsRecording_ = true;
+}
+
+void RenderCommandList2D::End()
+{
+	CHECK(bIsRecording_);
+	CHECK(RenderManager2D::recordingList_ == this);
+
+	RenderManager2D::recordingList_ = nullptr;
+	bIsRecording_ = false;
+}
+
+RenderManager2D::Vertex* RenderCommandList2D::Allocate(const RenderManager2D::RenderCommand::Type& type, const DrawMode& drawMode, bool bIsQuad, ITexture* texture, uint32_t vertexCount, uint32_t& outUnit)
+{
+	Item item;
+	item.type = type;
+	item.drawMode = drawMode;
+	item.bIsQuad = bIsQuad;
+	item.texture = texture;
+	item.sortLayer = sortLayer_;
+	item.startVertexIndex = static_cast<uint32_t>(vertices_.size());
+	item.vertexCount = vertexCount;
+	items_.push_back(item);
+
+	vertices_.resize(vertices_.size() + vertexCount);
+
+	outUnit = 0; /** ؽó  Submit  ٽ մϴ. */
+	return &vertices_[item.startVertexIndex];
+}
\ No newline at end of file
@@ -4,17 +4,28 @@
 #pragma warning(disable: 26451)
 #pragma warning(disable: 6031)
 
+#include <algorithm>
+#include <vector>
+#include <xmmintrin.h>
+
 #include <glad/glad.h>
 
 #include "Assertion.h"
 #include "Atlas2D.h"
 #include "Camera2D.h"
 #include "IEntity2D.h"
+#include "IndexBuffer.h"
 #include "ITexture.h"
+#include "RenderCommandList2D.h"
 #include "RenderManager2D.h"
 #include "ResourceManager.h"
 #include "Shader.h"
+#include "StaticBatch2D.h"
+#include "StreamTexture2D.h"
+#include "TextLayout.h"
+#include "TextRun.h"
 #include "TTFont.h"
+#include "TextureArray2D.h"
 #include "VertexBuffer.h"
 
 /**
@@ -23,7 +34,117 @@
  * https://stackoverflow.com/questions/10040961/opengl-pixel-perfect-2d-drawing
  */
 static const Vec2f PIXEL_OFFSET = Vec2f(0.375f, 0.375f);
+/**  Ÿӿ   ̺ ϱ  sin ԼԴϴ. [-, ]    Ϸ ޼ մϴ. */
+static constexpr double ConstexprSin(double x)
+{
+	const double pi = 3.14159265358979323846;
+	while (x > pi)
+	{
+		x -= 2.0 * pi;
+	}
+	while (x < -pi)
+	{
+		x += 2.0 * pi;
+	}
+
+	double term = x;
+	double sum = x;
+	for (int32_t n = 1; n < 12; ++n)
+	{
+		term *= -x * x / static_cast<double>((2 * n) * (2 * n + 1));
+		sum += term;
+	}
+
+	return sum;
+}
+
+static constexpr double ConstexprCos(double x)
+{
+	return ConstexprSin(x + 1.57079632679489661923);
+}
+
+/** 
+ * -   ̺Դϴ.   MIN_CIRCLE_SLICE_SIZE << level ̺   ̾ ٿϴ.
+ * -    ̹ܰǷ (  + 1) (cos, sin)  ϴ.
+ */
+static constexpr uint32_t CIRCLE_TABLE_SIZE = (RenderManager2D::MAX_CIRCLE_SLICE_SIZE * 2 - RenderManager2D::MIN_CIRCLE_SLICE_SIZE) + RenderManager2D::MAX_SLICE_LEVEL;
+static constexpr std::array<float, 2 * CIRCLE_TABLE_SIZE> CIRCLE_TABLE = []()
+	{
+		std::array<float, 2 * CIRCLE_TABLE_SIZE> table = { 0.0f, };
+		uint32_t offset = 0;
+		for (uint32_t level = 0; level < RenderManager2D::MAX_SLICE_LEVEL; ++level)
+		{
+			uint32_t sliceCount = RenderManager2D::MIN_CIRCLE_SLICE_SIZE << level;
+			for (uint32_t slice = 0; slice <= sliceCount; ++slice)
+			{
+				double radian = (static_cast<double>(slice % sliceCount) * 2.0 * 3.14159265358979323846) / static_cast<double>(sliceCount);
+				table[2 * (offset + slice) + 0] = static_cast<float>(ConstexprCos(radian));
+				table[2 * (offset + slice) + 1] = static_cast<float>(ConstexprSin(radian));
+			}
+			offset += sliceCount + 1;
+		}
+		return table;
+	}();
+
+/** 
+ * - 2   ġ ̺Դϴ. 𼭸   θ B(t) = (1-t)^2 * start + t^2 * end Դϴ.
+ * -   MIN_CORNER_SLICE_SIZE << level ̺   ̾ ٿ,  ׸ ((1-t)^2, t^2) Դϴ.
+ */
+static constexpr uint32_t CORNER_TABLE_SIZE = (RenderManager2D::MAX_CORNER_SLICE_SIZE * 2 - RenderManager2D::MIN_CORNER_SLICE_SIZE) + RenderManager2D::MAX_SLICE_LEVEL;
+static constexpr std::array<float, 2 * CORNER_TABLE_SIZE> CORNER_TABLE = []()
+	{
+		std::array<float, 2 * CORNER_TABLE_SIZE> table = { 0.0f, };
+		uint32_t offset = 0;
+		for (uint32_t level = 0; level < RenderManager2D::MAX_SLICE_LEVEL; ++level)
+		{
+			uint32_t sliceCount = RenderManager2D::MIN_CORNER_SLICE_SIZE << level;
+			for (uint32_t slice = 0; slice <= sliceCount; ++slice)
+			{
+				double t = static_cast<double>(slice) / static_cast<double>(sliceCount);
+				table[2 * (offset + slice) + 0] = static_cast<float>((1.0 - t) * (1.0 - t));
+				table[2 * (offset + slice) + 1] = static_cast<float>(t * t);
+			}
+			offset += sliceCount + 1;
+		}
+		return table;
+	}();
+
+/**  ̺  ġԴϴ.   (minSliceCount << level) ̺ տ (minSliceCount << i + 1) ׸ ֽϴ. */
+static inline uint32_t GetTableOffset(uint32_t minSliceCount, uint32_t level)
+{
+	return minSliceCount * ((1 << level) - 1) + level;
+}
+
+/** (x, y) * scale ȸ  translateŭ ̵մϴ. SSE   óմϴ. */
+static void TransformPoints(const float* srcPtr, uint32_t count, const Vec2f& scale, float cosTheta, float sinTheta, const Vec2f& translate, Vec2f* dstPtr)
+{
+	float* outPtr = reinterpret_cast<float*>(dstPtr);
+
+	__m128 scale4 = _mm_setr_ps(scale.x, scale.y, scale.x, scale.y);
+	__m128 cos4 = _mm_set1_ps(cosTheta);
+	__m128 sin4 = _mm_setr_ps(-sinTheta, +sinTheta, -sinTheta, +sinTheta);
+	__m128 translate4 = _mm_setr_ps(translate.x, translate.y, translate.x, translate.y);
+
+	uint32_t index = 0;
+	for (; index + 2 <= count; index += 2)
+	{
+		__m128 v = _mm_mul_ps(_mm_loadu_ps(srcPtr + 2 * index), scale4); /** [x0, y0, x1, y1] */
+		__m128 swapped = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)); /** [y0, x0, y1, x1] */
+		__m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(v, cos4), _mm_mul_ps(swapped, sin4)), translate4);
+		_mm_storeu_ps(outPtr + 2 * index, result);
+	}
+
+	for (; index < count; ++index)
+	{
+		float x = srcPtr[2 * index + 0] * scale.x;
+		float y = srcPtr[2 * index + 1] * scale.y;
+		outPtr[2 * index + 0] = cosTheta * x - sinTheta * y + translate.x;
+		outPtr[2 * index + 1] = sinTheta * x + cosTheta * y + translate.y;
+	}
+}
+
 RenderManager2D RenderManager2D::instance_;
+thread_local RenderCommandList2D* RenderManager2D::recordingList_ = nullptr;
 
 RenderManager2D& RenderManager2D::GetRef()
 {
@@ -41,63 +162,126 @@ void RenderManager2D::Startup()
 	resourceMgr_ = ResourceManager::GetPtr();
 
 	uint32_t byteSize = static_cast<uint32_t>(Vertex::GetStride() * vertices_.size());
-	VertexBuffer::Usage usage = VertexBuffer::Usage::DYNAMIC;
+	VertexBuffer::Usage usage = VertexBuffer::Usage::PERSISTENT;
 	vertexBuffer_ = resourceMgr_->Create<VertexBuffer>(byteSize, usage);
 
+	std::vector<uint32_t> indices(MAX_QUAD_SIZE * 6);
+	for (uint32_t quad = 0; quad < MAX_QUAD_SIZE; ++quad)
+	{
+		uint32_t index = quad * 6;
+		uint32_t vertex = quad * 4;
+
+		indices[index + 0] = vertex + 0;
+		indices[index + 1] = vertex + 1;
+		indices[index + 2] = vertex + 2;
+		indices[index + 3] = vertex + 2;
+		indices[index + 4] = vertex + 3;
+		indices[index + 5] = vertex + 0;
+	}
+	quadIndexBuffer_ = resourceMgr_->Create<IndexBuffer>(indices.data(), static_cast<uint32_t>(indices.size()));
+
 	GL_CHECK(glGenVertexArrays(1, &vertexArrayObject_));
 	GL_CHECK(glBindVertexArray(vertexArrayObject_));
 	{
 		vertexBuffer_->Bind();
+		SetVertexAttributes();
+		vertexBuffer_->Unbind();
+
+		/** ε  ε VAO ¿ ǹǷ VAO ε ¿  ʽϴ. */
+		quadIndexBuffer_->Bind();
+	}
+	GL_CHECK(glBindVertexArray(0));
+
+	uint32_t instanceByteSize = static_cast<uint32_t>(sizeof(SpriteInstance) * MAX_SPRITE_INSTANCE_SIZE);
+	instanceBuffer_ = resourceMgr_->Create<VertexBuffer>(instanceByteSize, VertexBuffer::Usage::PERSISTENT);
+
+	GL_CHECK(glGenVertexArrays(1, &instanceVertexArrayObject_));
+	GL_CHECK(glBindVertexArray(instanceVertexArrayObject_));
+	{
+		instanceBuffer_->Bind();
+
+		uint32_t stride = static_cast<uint32_t>(sizeof(SpriteInstance));
 
-		GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, position))));
+		GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)(offsetof(SpriteInstance, center))));
 		GL_CHECK(glEnableVertexAttribArray(0));
+		GL_CHECK(glVertexAttribDivisor(0, 1));
 
-		GL_CHECK(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, uv))));
+		GL_CHECK(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(offsetof(SpriteInstance, size))));
 		GL_CHECK(glEnableVertexAttribArray(1));
+		GL_CHECK(glVertexAttribDivisor(1, 1));
 
-		GL_CHECK(glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, color))));
+		/** packedRotate, packedTransparent ϳ vec2 нϴ. */
+		GL_CHECK(glVertexAttribPointer(2, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, (void*)(offsetof(SpriteInstance, packedRotate))));
 		GL_CHECK(glEnableVertexAttribArray(2));
+		GL_CHECK(glVertexAttribDivisor(2, 1));
 
-		GL_CHECK(glVertexAttribIPointer(3, 1, GL_INT, Vertex::GetStride(), (void*)(offsetof(Vertex, unit))));
+		GL_CHECK(glVertexAttribPointer(3, 4, GL_UNSIGNED_SHORT, GL_TRUE, stride, (void*)(offsetof(SpriteInstance, packedUV))));
 		GL_CHECK(glEnableVertexAttribArray(3));
+		GL_CHECK(glVertexAttribDivisor(3, 1));
 
-		GL_CHECK(glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, transparent))));
+		GL_CHECK(glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void*)(offsetof(SpriteInstance, packedBlend))));
 		GL_CHECK(glEnableVertexAttribArray(4));
+		GL_CHECK(glVertexAttribDivisor(4, 1));
 
-		vertexBuffer_->Unbind();
+		instanceBuffer_->Unbind();
 	}
 	GL_CHECK(glBindVertexArray(0));
 
 	Shader* geometry2D = resourceMgr_->Create<Shader>("MiniGame/Shader/Geometry2D.vert", "MiniGame/Shader/Geometry2D.frag");
 	Shader* sprite2D = resourceMgr_->Create<Shader>("MiniGame/Shader/Sprite2D.vert", "MiniGame/Shader/Sprite2D.frag");
 	Shader* string2D = resourceMgr_->Create<Shader>("MiniGame/Shader/String2D.vert", "MiniGame/Shader/String2D.frag");
+	Shader* spriteArray2D = resourceMgr_->Create<Shader>("MiniGame/Shader/Sprite2D.vert", "MiniGame/Shader/SpriteArray2D.frag");
+	Shader* spriteInstance2D = resourceMgr_->Create<Shader>("MiniGame/Shader/SpriteInstance2D.vert", "MiniGame/Shader/SpriteInstance2D.frag");
+	Shader* stringSDF2D = resourceMgr_->Create<Shader>("MiniGame/Shader/String2D.vert", "MiniGame/Shader/StringSDF2D.frag");
 
 	shaders_.insert({ RenderCommand::Type::GEOMETRY, geometry2D });
 	shaders_.insert({ RenderCommand::Type::SPRITE,   sprite2D });
 	shaders_.insert({ RenderCommand::Type::STRING,   string2D });
+	shaders_.insert({ RenderCommand::Type::SPRITE_ARRAY, spriteArray2D });
+	shaders_.insert({ RenderCommand::Type::SPRITE_INSTANCE, spriteInstance2D });
+	shaders_.insert({ RenderCommand::Type::STRING_SDF, stringSDF2D });
 }
 
 void RenderManager2D::Shutdown()
 {
+	resourceMgr_->Destroy(quadIndexBuffer_);
+	quadIndexBuffer_ = nullptr;
+
 	resourceMgr_->Destroy(vertexBuffer_);
 	vertexBuffer_ = nullptr;
 
+	resourceMgr_->Destroy(instanceBuffer_);
+	instanceBuffer_ = nullptr;
+
 	for (auto& shader : shaders_)
 	{
 		resourceMgr_->Destroy(shader.second);
 	}
 
+	GL_CHECK(glDeleteVertexArrays(1, &instanceVertexArrayObject_));
 	GL_CHECK(glDeleteVertexArrays(1, &vertexArrayObject_));
 
 	resourceMgr_ = nullptr;
 	renderStateMgr_ = nullptr;
 }
 
-void RenderManager2D::Begin(const Camera2D* camera2D)
+void RenderManager2D::Begin(const Camera2D* camera2D, bool bIsSorted)
 {
 	CHECK(!bIsBegin_);
 	CHECK(camera2D);
 
+	SetCullBounds(camera2D, bHasCullBounds_, cullMinPos_, cullMaxPos_);
+
+	GLint viewport[4] = { 0, };
+	GL_CHECK(glGetIntegerv(GL_VIEWPORT, viewport));
+	pixelScale_ = (camera2D->GetHeight() > 0.0f) ? static_cast<float>(viewport[3]) / camera2D->GetHeight() : 1.0f;
+
+	bIsSorted_ = bIsSorted;
+	sortLayer_ = 0;
+	sortVertexCount_ = 0;
+	sortItems_.clear();
+	sortTextureSlots_.clear();
+
 	Mat4x4 ortho = camera2D->GetOrtho();
 	for (auto& shader : shaders_)
 	{
@@ -129,31 +313,45 @@ void RenderManager2D::End()
 {
 	CHECK(bIsBegin_);
 
-	Flush();
+	if (bIsSorted_)
+	{
+		FlushSorted();
+	}
+	else
+	{
+		Flush();
+	}
+
+	/** ̹ ӿ       潺 ɰ   Ѿϴ. */
+	vertexBuffer_->Fence();
+	instanceBuffer_->Fence();
 
 	renderStateMgr_->SetCullFaceMode(originEnableCull_);
 	renderStateMgr_->SetDepthMode(originEnableDepth_);
 
+	/** ̹  ۸  ׷Ƿ,  Ʈ ش    ְ մϴ. */
+	TTFont::AdvanceGeneration();
+
+	bHasCullBounds_ = false;
 	bIsBegin_ = false;
 }
 
-void RenderManager2D::DrawPoint(const Vec2f& point, const Vec4f& color, float pointSize)
+void RenderManager2D::DrawPoint(const Vec2f& point, const Vec4f& color, float pointSize, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 6;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(point, pointSize * 0.5f))
 	{
-		Flush();
+		return;
 	}
 
+	static const uint32_t MAX_VERTEX_SIZE = 4;
+
 	float w = pointSize * 0.5f;
 	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
 	{
-		Vec2f(-w, -w),
-		Vec2f(+w, +w),
-		Vec2f(-w, +w),
 		Vec2f(-w, -w),
 		Vec2f(+w, -w),
 		Vec2f(+w, +w),
+		Vec2f(-w, +w),
 	};
 
 	for (auto& vertex : vertices)
@@ -161,109 +359,48 @@ void RenderManager2D::DrawPoint(const Vec2f& point, const Vec4f& color, float po
 		vertex += (point + PIXEL_OFFSET);
 	}
 
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		if (prevCommand.drawMode == DrawMode::TRIANGLES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
-			}
-
-			return;
-		}
-	}
-
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
-
-	RenderCommand command;
-	command.drawMode = DrawMode::TRIANGLES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
-
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::TRIANGLES, true, nullptr, static_cast<uint32_t>(vertices.size()), unit);
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].color = color;
 	}
-
-	commandQueue_.push(command);
 }
 
-void RenderManager2D::DrawLine(const Vec2f& startPos, const Vec2f& endPos, const Vec4f& color)
+void RenderManager2D::DrawLine(const Vec2f& startPos, const Vec2f& endPos, const Vec4f& color, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 2;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(startPos, startPos, endPos))
 	{
-		Flush();
+		return;
 	}
 
+	static const uint32_t MAX_VERTEX_SIZE = 2;
+
 	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
 	{
 		startPos + PIXEL_OFFSET,
 		  endPos + PIXEL_OFFSET,
 	};
 
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-
-		if (prevCommand.drawMode == DrawMode::LINES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
-			}
-
-			return;
-		}
-	}
-
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
-
-	RenderCommand command;
-	command.drawMode = DrawMode::LINES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
-
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::LINES, false, nullptr, static_cast<uint32_t>(vertices.size()), unit);
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].color = color;
 	}
-
-	commandQueue_.push(command);
 }
 
-void RenderManager2D::DrawLine(const Vec2f& startPos, const Vec4f& startColor, const Vec2f& endPos, const Vec4f& endColor)
+void RenderManager2D::DrawLine(const Vec2f& startPos, const Vec4f& startColor, const Vec2f& endPos, const Vec4f& endColor, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 2;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(startPos, startPos, endPos))
 	{
-		Flush();
+		return;
 	}
 
+	static const uint32_t MAX_VERTEX_SIZE = 2;
+
 	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
 	{
 		startPos + PIXEL_OFFSET,
@@ -276,55 +413,24 @@ void RenderManager2D::DrawLine(const Vec2f& startPos, const Vec4f& startColor, c
 		endColor,
 	};
 
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-
-		if (prevCommand.drawMode == DrawMode::LINES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = colors[index];
-			}
-
-			return;
-		}
-	}
-
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
-
-	RenderCommand command;
-	command.drawMode = DrawMode::LINES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
-
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::LINES, false, nullptr, static_cast<uint32_t>(vertices.size()), unit);
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = colors[index];
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].color = colors[index];
 	}
-
-	commandQueue_.push(command);
 }
 
-void RenderManager2D::DrawTriangle(const Vec2f& fromPos, const Vec2f& byPos, const Vec2f& toPos, const Vec4f& color)
+void RenderManager2D::DrawTriangle(const Vec2f& fromPos, const Vec2f& byPos, const Vec2f& toPos, const Vec4f& color, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 3;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(fromPos, byPos, toPos))
 	{
-		Flush();
+		return;
 	}
 
+	static const uint32_t MAX_VERTEX_SIZE = 3;
+
 	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
 	{
 		fromPos + PIXEL_OFFSET,
@@ -332,55 +438,24 @@ void RenderManager2D::DrawTriangle(const Vec2f& fromPos, const Vec2f& byPos, con
 		  toPos + PIXEL_OFFSET,
 	};
 
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-
-		if (prevCommand.drawMode == DrawMode::TRIANGLES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
-			}
-
-			return;
-		}
-	}
-
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
-
-	RenderCommand command;
-	command.drawMode = DrawMode::TRIANGLES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
-
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::TRIANGLES, false, nullptr, static_cast<uint32_t>(vertices.size()), unit);
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].color = color;
 	}
-
-	commandQueue_.push(command);
 }
 
-void RenderManager2D::DrawTriangle(const Vec2f& fromPos, const Vec4f& fromColor, const Vec2f& byPos, const Vec4f& byColor, const Vec2f& toPos, const Vec4f& toColor)
+void RenderManager2D::DrawTriangle(const Vec2f& fromPos, const Vec4f& fromColor, const Vec2f& byPos, const Vec4f& byColor, const Vec2f& toPos, const Vec4f& toColor, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 3;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(fromPos, byPos, toPos))
 	{
-		Flush();
+		return;
 	}
 
+	static const uint32_t MAX_VERTEX_SIZE = 3;
+
 	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
 	{
 		fromPos + PIXEL_OFFSET,
@@ -395,55 +470,24 @@ void RenderManager2D::DrawTriangle(const Vec2f& fromPos, const Vec4f& fromColor,
 		  toColor,
 	};
 
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-
-		if (prevCommand.drawMode == DrawMode::TRIANGLES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = colors[index];
-			}
-
-			return;
-		}
-	}
-
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
-
-	RenderCommand command;
-	command.drawMode = DrawMode::TRIANGLES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
-
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::TRIANGLES, false, nullptr, static_cast<uint32_t>(vertices.size()), unit);
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = colors[index];
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].color = colors[index];
 	}
-
-	commandQueue_.push(command);
 }
 
-void RenderManager2D::DrawTriangleWireframe(const Vec2f& fromPos, const Vec2f& byPos, const Vec2f& toPos, const Vec4f& color)
+void RenderManager2D::DrawTriangleWireframe(const Vec2f& fromPos, const Vec2f& byPos, const Vec2f& toPos, const Vec4f& color, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 6;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(fromPos, byPos, toPos))
 	{
-		Flush();
+		return;
 	}
 
+	static const uint32_t MAX_VERTEX_SIZE = 6;
+
 	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
 	{
 		fromPos + PIXEL_OFFSET,   byPos + PIXEL_OFFSET,
@@ -451,55 +495,24 @@ void RenderManager2D::DrawTriangleWireframe(const Vec2f& fromPos, const Vec2f& b
 		  toPos + PIXEL_OFFSET, fromPos + PIXEL_OFFSET,
 	};
 
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-
-		if (prevCommand.drawMode == DrawMode::LINES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
-			}
-
-			return;
-		}
-	}
-
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
-
-	RenderCommand command;
-	command.drawMode = DrawMode::LINES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
-
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::LINES, false, nullptr, static_cast<uint32_t>(vertices.size()), unit);
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].color = color;
 	}
-
-	commandQueue_.push(command);
 }
 
-void RenderManager2D::DrawTriangleWireframe(const Vec2f& fromPos, const Vec4f& fromColor, const Vec2f& byPos, const Vec4f& byColor, const Vec2f& toPos, const Vec4f& toColor)
+void RenderManager2D::DrawTriangleWireframe(const Vec2f& fromPos, const Vec4f& fromColor, const Vec2f& byPos, const Vec4f& byColor, const Vec2f& toPos, const Vec4f& toColor, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 6;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(fromPos, byPos, toPos))
 	{
-		Flush();
+		return;
 	}
 
+	static const uint32_t MAX_VERTEX_SIZE = 6;
+
 	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
 	{
 		fromPos + PIXEL_OFFSET,   byPos + PIXEL_OFFSET,
@@ -514,66 +527,33 @@ void RenderManager2D::DrawTriangleWireframe(const Vec2f& fromPos, const Vec4f& f
 	  	  toColor, fromColor,
 	};
 
-	if (!commandQueue_.empty())
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::LINES, false, nullptr, static_cast<uint32_t>(vertices.size()), unit);
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
-
-		if (prevCommand.drawMode == DrawMode::LINES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].color = colors[index];
+	}
+}
 
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = colors[index];
-			}
-
-			return;
-		}
-	}
-
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
-
-	RenderCommand command;
-	command.drawMode = DrawMode::LINES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
-
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
-	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = colors[index];
-	}
-
-	commandQueue_.push(command);
-}
-
-void RenderManager2D::DrawRect(const Vec2f& center, float w, float h, const Vec4f& color, float rotate)
+void RenderManager2D::DrawRect(const Vec2f& center, float w, float h, const Vec4f& color, float rotate, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 6;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(center, 0.5f * GameMath::Sqrt(w * w + h * h)))
 	{
-		Flush();
+		return;
 	}
 
+	static const uint32_t MAX_VERTEX_SIZE = 4;
+
 	float w2 = w * 0.5f;
 	float h2 = h * 0.5f;
 
 	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
 	{
-		Vec2f(-w2, -h2),
-		Vec2f(+w2, +h2),
-		Vec2f(-w2, +h2),
 		Vec2f(-w2, -h2),
 		Vec2f(+w2, -h2),
 		Vec2f(+w2, +h2),
+		Vec2f(-w2, +h2),
 	};
 
 	Mat2x2 rotateMat = Mat2x2(
@@ -586,55 +566,24 @@ void RenderManager2D::DrawRect(const Vec2f& center, float w, float h, const Vec4
 		vertex += (center + PIXEL_OFFSET);
 	}
 
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-
-		if (prevCommand.drawMode == DrawMode::TRIANGLES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
-			}
-
-			return;
-		}
-	}
-
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
-
-	RenderCommand command;
-	command.drawMode = DrawMode::TRIANGLES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
-
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::TRIANGLES, true, nullptr, static_cast<uint32_t>(vertices.size()), unit);
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].color = color;
 	}
-
-	commandQueue_.push(command);
 }
 
-void RenderManager2D::DrawRectWireframe(const Vec2f& center, float w, float h, const Vec4f& color, float rotate)
+void RenderManager2D::DrawRectWireframe(const Vec2f& center, float w, float h, const Vec4f& color, float rotate, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 8;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(center, 0.5f * GameMath::Sqrt(w * w + h * h)))
 	{
-		Flush();
+		return;
 	}
 
+	static const uint32_t MAX_VERTEX_SIZE = 8;
+
 	float w2 = w * 0.5f;
 	float h2 = h * 0.5f;
 
@@ -656,663 +605,677 @@ void RenderManager2D::DrawRectWireframe(const Vec2f& center, float w, float h, c
 		vertex += (center + PIXEL_OFFSET);
 	}
 
-	if (!commandQueue_.empty())
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::LINES, false, nullptr, static_cast<uint32_t>(vertices.size()), unit);
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
-
-		if (prevCommand.drawMode == DrawMode::LINES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
-			}
-
-			return;
-		}
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].color = color;
 	}
+}
 
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
+void RenderManager2D::DrawRoundRect(const Vec2f& center, float w, float h, float side, const Vec4f& color, float rotate, bool bIsCulling)
+{
+	if (bIsCulling && IsCulled(center, 0.5f * GameMath::Sqrt(w * w + h * h)))
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
+		return;
 	}
 
-	RenderCommand command;
-	command.drawMode = DrawMode::LINES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
+	std::array<Vec2f, MAX_ROUND_RECT_OUTLINE_SIZE> outline;
+	uint32_t outlineCount = CalculateRoundRectOutline(center, w, h, side, rotate, outline.data());
 
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+	/** 簢 ߽  ܰ ̿   մ ﰢ Դϴ. */
+	uint32_t vertexCount = 3 * outlineCount;
+	Vec2f centerPos = center + PIXEL_OFFSET;
+
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::TRIANGLES, false, nullptr, vertexCount, unit);
+	for (uint32_t index = 0; index < outlineCount; ++index)
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
+		vertexPtr[3 * index + 0].position = centerPos;
+		vertexPtr[3 * index + 1].position = outline[index];
+		vertexPtr[3 * index + 2].position = outline[(index + 1) % outlineCount];
 	}
 
-	commandQueue_.push(command);
+	for (uint32_t index = 0; index < vertexCount; ++index)
+	{
+		vertexPtr[index].color = color;
+	}
 }
 
-void RenderManager2D::DrawRoundRect(const Vec2f& center, float w, float h, float side, const Vec4f& color, float rotate)
+void RenderManager2D::DrawRoundRectWireframe(const Vec2f& center, float w, float h, float side, const Vec4f& color, float rotate, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 252;
-	static const uint32_t MAX_SLICE_SIZE = 20;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	if (bIsCulling && IsCulled(center, 0.5f * GameMath::Sqrt(w * w + h * h)))
 	{
-		Flush();
+		return;
 	}
 
-	float w2 = w * 0.5f;
-	float h2 = h * 0.5f;
-	side = GameMath::Min<float>(side, GameMath::Min<float>(h2, h2));
-
-	uint32_t vertexCount = 0;
-	std::array<Vec2f, MAX_VERTEX_SIZE> vertices;
-
-	auto calculateBezierCurve = [&](const Vec2f& startPos, const Vec2f& endPos, const Vec2f& controlPos, uint32_t sliceCount)
-		{
-			for (int32_t slice = 0; slice < sliceCount; ++slice)
-			{
-				float t0 = static_cast<float>(slice + 0) / static_cast<float>(sliceCount);
-				float t1 = static_cast<float>(slice + 1) / static_cast<float>(sliceCount);
-
-				vertices[vertexCount + 0] = Vec2f();
-				vertices[vertexCount + 1] = Vec2f::Bezier(startPos, endPos, controlPos, t0);
-				vertices[vertexCount + 2] = Vec2f::Bezier(startPos, endPos, controlPos, t1);
+	std::array<Vec2f, MAX_ROUND_RECT_OUTLINE_SIZE> outline;
+	uint32_t outlineCount = CalculateRoundRectOutline(center, w, h, side, rotate, outline.data());
 
-				vertexCount += 3;
-			}
-		};
-
-	Vec2f control = Vec2f(-w2, +h2);
-	Vec2f start = control + Vec2f(+side, 0.0f);
-	Vec2f end = control + Vec2f(0.0f, -side);
-	calculateBezierCurve(start, end, control, MAX_SLICE_SIZE);
-
-	vertices[vertexCount + 0] = Vec2f();
-	vertices[vertexCount + 1] = Vec2f(-w2, +h2) + Vec2f(0.0f, -side);
-	vertices[vertexCount + 2] = Vec2f(-w2, -h2) + Vec2f(0.0f, +side);
-	vertexCount += 3;
-
-	control = Vec2f(-w2, -h2);
-	start = control + Vec2f(0.0f, +side);
-	end = control + Vec2f(+side, 0.0f);
-	calculateBezierCurve(start, end, control, MAX_SLICE_SIZE);
-
-	vertices[vertexCount + 0] = Vec2f();
-	vertices[vertexCount + 1] = Vec2f(-w2, -h2) + Vec2f(+side, 0.0f);
-	vertices[vertexCount + 2] = Vec2f(+w2, -h2) + Vec2f(-side, 0.0f);
-	vertexCount += 3;
-
-	control = Vec2f(+w2, -h2);
-	start = control + Vec2f(-side, 0.0f);
-	end = control + Vec2f(0.0f, +side);
-	calculateBezierCurve(start, end, control, MAX_SLICE_SIZE);
-
-	vertices[vertexCount + 0] = Vec2f();
-	vertices[vertexCount + 1] = Vec2f(+w2, -h2) + Vec2f(0.0f, +side);
-	vertices[vertexCount + 2] = Vec2f(+w2, +h2) + Vec2f(0.0f, -side);
-	vertexCount += 3;
-
-	control = Vec2f(+w2, +h2);
-	start = control + Vec2f(0.0f, -side);
-	end = control + Vec2f(-side, 0.0f);
-	calculateBezierCurve(start, end, control, MAX_SLICE_SIZE);
-
-	vertices[vertexCount + 0] = Vec2f();
-	vertices[vertexCount + 1] = Vec2f(+w2, +h2) + Vec2f(-side, 0.0f);
-	vertices[vertexCount + 2] = Vec2f(-w2, +h2) + Vec2f(+side, 0.0f);
-	vertexCount += 3;
+	uint32_t vertexCount = 2 * outlineCount;
 
-	Mat2x2 rotateMat = Mat2x2(
-		+GameMath::Cos(rotate), -GameMath::Sin(rotate),
-		+GameMath::Sin(rotate), +GameMath::Cos(rotate)
-	);
-	for (uint32_t index = 0; index < vertexCount; index += 3)
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::LINES, false, nullptr, vertexCount, unit);
+	for (uint32_t index = 0; index < outlineCount; ++index)
 	{
-		vertices[index + 1] = rotateMat * vertices[index + 1];
-		vertices[index + 2] = rotateMat * vertices[index + 2];
+		vertexPtr[2 * index + 0].position = outline[index];
+		vertexPtr[2 * index + 1].position = outline[(index + 1) % outlineCount];
+	}
 
-		vertices[index + 0] += (center + PIXEL_OFFSET);
-		vertices[index + 1] += (center + PIXEL_OFFSET);
-		vertices[index + 2] += (center + PIXEL_OFFSET);
+	for (uint32_t index = 0; index < vertexCount; ++index)
+	{
+		vertexPtr[index].color = color;
 	}
+}
 
-	if (!commandQueue_.empty())
+void RenderManager2D::DrawCircle(const Vec2f& center, float radius, const Vec4f& color, bool bIsCulling)
+{
+	if (bIsCulling && IsCulled(center, radius))
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
+		return;
+	}
 
-		if (prevCommand.drawMode == DrawMode::TRIANGLES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
+	std::array<Vec2f, MAX_CIRCLE_SLICE_SIZE + 1> outline;
+	uint32_t sliceCount = CalculateCircleOutline(center, radius, outline.data());
 
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
-			}
+	uint32_t vertexCount = 3 * sliceCount;
+	Vec2f centerPos = center + PIXEL_OFFSET;
 
-			return;
-		}
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::TRIANGLES, false, nullptr, vertexCount, unit);
+	for (uint32_t slice = 0; slice < sliceCount; ++slice)
+	{
+		vertexPtr[3 * slice + 0].position = centerPos;
+		vertexPtr[3 * slice + 1].position = outline[slice + 0];
+		vertexPtr[3 * slice + 2].position = outline[slice + 1];
 	}
 
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
+	for (uint32_t index = 0; index < vertexCount; ++index)
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
+		vertexPtr[index].color = color;
 	}
+}
 
-	RenderCommand command;
-	command.drawMode = DrawMode::TRIANGLES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
+void RenderManager2D::DrawCircleWireframe(const Vec2f& center, float radius, const Vec4f& color, bool bIsCulling)
+{
+	if (bIsCulling && IsCulled(center, radius))
+	{
+		return;
+	}
+
+	std::array<Vec2f, MAX_CIRCLE_SLICE_SIZE + 1> outline;
+	uint32_t sliceCount = CalculateCircleOutline(center, radius, outline.data());
 
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+	uint32_t vertexCount = 2 * sliceCount;
+
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(RenderCommand::Type::GEOMETRY, DrawMode::LINES, false, nullptr, vertexCount, unit);
+	for (uint32_t slice = 0; slice < sliceCount; ++slice)
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
+		vertexPtr[2 * slice + 0].position = outline[slice + 0];
+		vertexPtr[2 * slice + 1].position = outline[slice + 1];
 	}
 
-	commandQueue_.push(command);
+	for (uint32_t index = 0; index < vertexCount; ++index)
+	{
+		vertexPtr[index].color = color;
+	}
 }
 
-void RenderManager2D::DrawRoundRectWireframe(const Vec2f& center, float w, float h, float side, const Vec4f& color, float rotate)
+void RenderManager2D::DrawSprite(ITexture* texture, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 168;
-	static const uint32_t MAX_SLICE_SIZE = 20;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	std::array<Vec2f, 4> uvs =
 	{
-		Flush();
-	}
+		Vec2f(0.0f, 1.0f),
+		Vec2f(1.0f, 1.0f),
+		Vec2f(1.0f, 0.0f),
+		Vec2f(0.0f, 0.0f),
+	};
 
-	float w2 = w * 0.5f;
-	float h2 = h * 0.5f;
-	side = GameMath::Min<float>(side, GameMath::Min<float>(h2, h2));
+	DrawSpriteQuad(RenderCommand::Type::SPRITE, texture, -1, uvs, center, w, h, rotate, options);
+}
 
-	uint32_t vertexCount = 0;
-	std::array<Vec2f, MAX_VERTEX_SIZE> vertices;
+void RenderManager2D::DrawSprite(StreamTexture2D* texture, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
+{
+	if (options.bIsCulling && IsCulled(center, 0.5f * GameMath::Sqrt(w * w + h * h)))
+	{
+		return;
+	}
 
-	auto calculateBezierCurve = [&](const Vec2f& startPos, const Vec2f& endPos, const Vec2f& controlPos, uint32_t sliceCount)
-		{
-			for (int32_t slice = 0; slice < sliceCount; ++slice)
-			{
-				float t0 = static_cast<float>(slice + 0) / static_cast<float>(sliceCount);
-				float t1 = static_cast<float>(slice + 1) / static_cast<float>(sliceCount);
+	/** ø  Ʈ  ûմϴ. ø ̹ Ƿ ߺ  ʽϴ. */
+	texture->RequestSize(w * pixelScale_, h * pixelScale_);
 
-				vertices[vertexCount + 0] = Vec2f::Bezier(startPos, endPos, controlPos, t0);
-				vertices[vertexCount + 1] = Vec2f::Bezier(startPos, endPos, controlPos, t1);
-				vertexCount += 2;
-			}
-		};
+	SpriteRenderOptions drawOptions = options;
+	drawOptions.bIsCulling = false;
+	DrawSprite(static_cast<ITexture*>(texture), center, w, h, rotate, drawOptions);
+}
 
-	Vec2f control = Vec2f(-w2, +h2);
-	Vec2f start = control + Vec2f(+side, 0.0f);
-	Vec2f end = control + Vec2f(0.0f, -side);
-	calculateBezierCurve(start, end, control, MAX_SLICE_SIZE);
+void RenderManager2D::DrawSprite(Atlas2D* atlas, const std::string& name, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
+{
+	DrawSprite(atlas, atlas->Find(name), center, w, h, rotate, options);
+}
 
-	vertices[vertexCount + 0] = Vec2f(-w2, +h2) + Vec2f(0.0f, -side);
-	vertices[vertexCount + 1] = Vec2f(-w2, -h2) + Vec2f(0.0f, +side);
-	vertexCount += 2;
+void RenderManager2D::DrawSprite(Atlas2D* atlas, uint32_t spriteID, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
+{
+	CHECK(atlas->IsValidSpriteID(spriteID));
+	DrawSpriteQuad(RenderCommand::Type::SPRITE, atlas, -1, atlas->GetUVs(spriteID), center, w, h, rotate, options);
+}
 
-	control = Vec2f(-w2, -h2);
-	start = control + Vec2f(0.0f, +side);
-	end = control + Vec2f(+side, 0.0f);
-	calculateBezierCurve(start, end, control, MAX_SLICE_SIZE);
+void RenderManager2D::DrawSprite(TextureArray2D* textureArray, int32_t layer, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
+{
+	const Vec2i& layerSize = textureArray->GetLayerSize(layer);
+	float u1 = static_cast<float>(layerSize.x) / static_cast<float>(textureArray->GetWidth());
+	float v1 = static_cast<float>(layerSize.y) / static_cast<float>(textureArray->GetHeight());
 
-	vertices[vertexCount + 0] = Vec2f(-w2, -h2) + Vec2f(+side, 0.0f);
-	vertices[vertexCount + 1] = Vec2f(+w2, -h2) + Vec2f(-side, 0.0f);
-	vertexCount += 2;
+	std::array<Vec2f, 4> uvs =
+	{
+		Vec2f(0.0f, v1),
+		Vec2f(  u1, v1),
+		Vec2f(  u1, 0.0f),
+		Vec2f(0.0f, 0.0f),
+	};
 
-	control = Vec2f(+w2, -h2);
-	start = control + Vec2f(-side, 0.0f);
-	end = control + Vec2f(0.0f, +side);
-	calculateBezierCurve(start, end, control, MAX_SLICE_SIZE);
+	DrawSpriteQuad(RenderCommand::Type::SPRITE_ARRAY, textureArray, layer, uvs, center, w, h, rotate, options);
+}
 
-	vertices[vertexCount + 0] = Vec2f(+w2, -h2) + Vec2f(0.0f, +side);
-	vertices[vertexCount + 1] = Vec2f(+w2, +h2) + Vec2f(0.0f, -side);
-	vertexCount += 2;
+void RenderManager2D::DrawSprite(TextureArray2D* textureArray, int32_t layer, Atlas2D* atlas, const std::string& name, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
+{
+	DrawSprite(textureArray, layer, atlas, atlas->Find(name), center, w, h, rotate, options);
+}
 
-	control = Vec2f(+w2, +h2);
-	start = control + Vec2f(0.0f, -side);
-	end = control + Vec2f(-side, 0.0f);
-	calculateBezierCurve(start, end, control, MAX_SLICE_SIZE);
+void RenderManager2D::DrawSprite(TextureArray2D* textureArray, int32_t layer, Atlas2D* atlas, uint32_t spriteID, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
+{
+	CHECK(atlas->IsValidSpriteID(spriteID));
 
-	vertices[vertexCount + 0] = Vec2f(+w2, +h2) + Vec2f(-side, 0.0f);
-	vertices[vertexCount + 1] = Vec2f(-w2, +h2) + Vec2f(+side, 0.0f);
-	vertexCount += 2;
+	/** Ʋ󽺴 ̾ »ܿ ġǹǷ  ǥ ؽó 迭 ũ ȭմϴ. */
+	const Atlas2D::Block& block = atlas->GetBlock(spriteID);
+	float x0 = static_cast<float>(block.pos.x);
+	float y0 = static_cast<float>(block.pos.y);
+	float x1 = static_cast<float>(block.pos.x + block.size.x);
+	float y1 = static_cast<float>(block.pos.y + block.size.y);
+	float arrayWidth = static_cast<float>(textureArray->GetWidth());
+	float arrayHeight = static_cast<float>(textureArray->GetHeight());
 
-	Mat2x2 rotateMat = Mat2x2(
-		+GameMath::Cos(rotate), -GameMath::Sin(rotate),
-		+GameMath::Sin(rotate), +GameMath::Cos(rotate)
-	);
-	for (uint32_t index = 0; index < vertexCount; index += 2)
+	std::array<Vec2f, 4> uvs =
 	{
-		vertices[index + 0] = rotateMat * vertices[index + 0];
-		vertices[index + 1] = rotateMat * vertices[index + 1];
+		Vec2f(x0 / arrayWidth, y1 / arrayHeight),
+		Vec2f(x1 / arrayWidth, y1 / arrayHeight),
+		Vec2f(x1 / arrayWidth, y0 / arrayHeight),
+		Vec2f(x0 / arrayWidth, y0 / arrayHeight),
+	};
 
-		vertices[index + 0] += (center + PIXEL_OFFSET);
-		vertices[index + 1] += (center + PIXEL_OFFSET);
-	}
+	DrawSpriteQuad(RenderCommand::Type::SPRITE_ARRAY, textureArray, layer, uvs, center, w, h, rotate, options);
+}
 
-	if (!commandQueue_.empty())
+void RenderManager2D::DrawSpriteInstanced(ITexture* texture, const SpriteInstance* instances, uint32_t count)
+{
+	CHECK(texture && instances);
+	CHECK(recordingList_ == nullptr); /** Ŀǵ Ʈ   ϴ. */
+
+	if (count == 0)
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
+		return;
+	}
 
-		if (prevCommand.drawMode == DrawMode::LINES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
+	Flush(); /**   Ŀǵ ׸  մϴ. */
 
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
-			}
+	texture->Active(0);
 
-			return;
-		}
-	}
+	Shader* shader = shaders_.at(RenderCommand::Type::SPRITE_INSTANCE);
+	shader->Bind();
+	stats_.stateChangeCount += 2;
 
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
+	GL_CHECK(glBindVertexArray(instanceVertexArrayObject_));
+	for (uint32_t offset = 0; offset < count; offset += MAX_SPRITE_INSTANCE_SIZE)
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
+		uint32_t remainCount = count - offset;
+		uint32_t instanceCount = (remainCount < MAX_SPRITE_INSTANCE_SIZE) ? remainCount : MAX_SPRITE_INSTANCE_SIZE; /** Ŭ     ѱ ʵ GameMath::Min  ʽϴ. */
+		uint32_t bufferByteSize = static_cast<uint32_t>(sizeof(SpriteInstance) * instanceCount);
+		instanceBuffer_->SetBufferData(reinterpret_cast<const void*>(instances + offset), bufferByteSize);
 
-	RenderCommand command;
-	command.drawMode = DrawMode::LINES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
+		stats_.uploadByteSize += bufferByteSize;
+		stats_.flushCount++;
 
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
-	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
+		/**  ۿ  ġ  νϽ մϴ. */
+		uint32_t baseInstance = instanceBuffer_->GetWriteOffset() / static_cast<uint32_t>(sizeof(SpriteInstance));
+		GL_CHECK(glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4, instanceCount, baseInstance));
+		stats_.drawCallCount++;
 	}
+	GL_CHECK(glBindVertexArray(0));
 
-	commandQueue_.push(command);
+	shader->Unbind();
 }
 
-void RenderManager2D::DrawCircle(const Vec2f& center, float radius, const Vec4f& color)
+void RenderManager2D::DrawBatch(StaticBatch2D* batch, const Mat4x4& transform)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 300;
-	static const uint32_t MAX_SLICE_SIZE = 100;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	CHECK(bIsBegin_);
+	CHECK(recordingList_ == nullptr);
+	CHECK(batch != nullptr && !batch->IsDirty());
+
+	if (batch->segments_.empty())
 	{
-		Flush();
+		return;
 	}
 
-	uint32_t vertexCount = 0;
-	std::array<Vec2f, MAX_VERTEX_SIZE> vertices;
-
-	for (int32_t slice = 0; slice < MAX_SLICE_SIZE; ++slice)
+	/**   Ŀǵ ׸  մϴ. */
+	if (bIsSorted_)
 	{
-		float radian0 = (static_cast<float>(slice + 0) * TWO_PI) / static_cast<float>(MAX_SLICE_SIZE);
-		float radian1 = (static_cast<float>(slice + 1) * TWO_PI) / static_cast<float>(MAX_SLICE_SIZE);
-
-		vertices[vertexCount + 0] = center + PIXEL_OFFSET;
-		vertices[vertexCount + 1] = center + Vec2f(radius * GameMath::Cos(radian0), radius * GameMath::Sin(radian0)) + PIXEL_OFFSET;
-		vertices[vertexCount + 2] = center + Vec2f(radius * GameMath::Cos(radian1), radius * GameMath::Sin(radian1)) + PIXEL_OFFSET;
-
-		vertexCount += 3;
+		FlushSorted();
 	}
-
-	if (!commandQueue_.empty())
+	else
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
+		Flush();
+	}
+
+	GL_CHECK(glBindVertexArray(batch->vertexArrayObject_));
 
-		if (prevCommand.drawMode == DrawMode::TRIANGLES && prevCommand.type == RenderCommand::Type::GEOMETRY)
+	Shader* shader = nullptr;
+	for (const auto& segment : batch->segments_)
+	{
+		for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
 		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
+			if (segment.texture[unit])
+			{
+				segment.texture[unit]->Active(unit);
+				stats_.stateChangeCount++;
+			}
+		}
 
-			for (uint32_t index = 0; index < vertices.size(); ++index)
+		Shader* segmentShader = shaders_.at(segment.type);
+		if (shader != segmentShader)
+		{
+			if (shader)
 			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
+				shader->SetUniform("world", Mat4x4::Identity());
 			}
 
-			return;
+			shader = segmentShader;
+			shader->Bind();
+			shader->SetUniform("world", transform);
+			stats_.stateChangeCount++;
 		}
-	}
 
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
+		if (segment.bIsQuad)
+		{
+			uint32_t indexCount = (segment.vertexCount / 4) * 6;
+			GL_CHECK(glDrawElementsBaseVertex(static_cast<GLenum>(segment.drawMode), indexCount, GL_UNSIGNED_INT, nullptr, static_cast<GLint>(segment.startVertexIndex)));
+		}
+		else
+		{
+			GL_CHECK(glDrawArrays(static_cast<GLenum>(segment.drawMode), segment.startVertexIndex, segment.vertexCount));
+		}
+		stats_.drawCallCount++;
 	}
 
-	RenderCommand command;
-	command.drawMode = DrawMode::TRIANGLES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
+	shader->SetUniform("world", Mat4x4::Identity());
+	shader->Unbind();
 
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
-	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
-	}
+	GL_CHECK(glBindVertexArray(0));
+}
 
-	commandQueue_.push(command);
+void RenderManager2D::DrawString(TTFont* font, const std::wstring& text, const Vec2f& pos, const Vec4f& color, bool bIsCulling)
+{
+	DrawString(font, text, pos, 1.0f, color, bIsCulling);
 }
 
-void RenderManager2D::DrawCircleWireframe(const Vec2f& center, float radius, const Vec4f& color)
+void RenderManager2D::DrawString(TTFont* font, const std::wstring& text, const Vec2f& pos, float scale, const Vec4f& color, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 200;
-	static const uint32_t MAX_SLICE_SIZE = 100;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	/**  ϳ  4. */
+	uint32_t vertexCount = 4 * static_cast<uint32_t>(text.size());
+
+	float w = 0.0f;
+	float h = 0.0f;
+	font->MeasureText(text, w, h);
+
+	w *= scale;
+	h *= scale;
+
+	/** ۸ (xoff, yoff)     Ƿ  ݸŭ  Ӵϴ. */
+	float margin = h * 0.5f;
+	if (bIsCulling && IsCulled(Vec2f(pos.x - margin, pos.y - h - margin), Vec2f(pos.x + w + margin, pos.y + margin)))
 	{
-		Flush();
+		return;
 	}
 
-	uint32_t vertexCount = 0;
-	std::array<Vec2f, MAX_VERTEX_SIZE> vertices;
+	float atlasWidth = static_cast<float>(font->GetAtlasWidth());
+	float atlasHeight = static_cast<float>(font->GetAtlasHeight());
+	Vec2f currPos = Vec2f(pos.x, pos.y - h);
 
-	for (int32_t slice = 0; slice < MAX_SLICE_SIZE; ++slice)
+	uint32_t unit = 0;
+	RenderCommand::Type type = font->IsSDF() ? RenderCommand::Type::STRING_SDF : RenderCommand::Type::STRING;
+	Vertex* vertexPtr = AllocateVertices(type, DrawMode::TRIANGLES, true, font, vertexCount, unit);
+	uint32_t vertexIndex = 0;
+	for (const auto& unicode : text)
 	{
-		float radian0 = (static_cast<float>(slice + 0) * TWO_PI) / static_cast<float>(MAX_SLICE_SIZE);
-		float radian1 = (static_cast<float>(slice + 1) * TWO_PI) / static_cast<float>(MAX_SLICE_SIZE);
+		Glyph glyph = font->GetGlyph(static_cast<int32_t>(unicode));
 
-		vertices[vertexCount + 0] = center + Vec2f(radius * GameMath::Cos(radian0), radius * GameMath::Sin(radian0)) + PIXEL_OFFSET;
-		vertices[vertexCount + 1] = center + Vec2f(radius * GameMath::Cos(radian1), radius * GameMath::Sin(radian1)) + PIXEL_OFFSET;
+		float uw = scale * static_cast<float>(glyph.pos1.x - glyph.pos0.x);
+		float uh = scale * static_cast<float>(glyph.pos1.y - glyph.pos0.y);
 
-		vertexCount += 2;
-	}
-
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
+		float x0 = currPos.x + scale * glyph.xoff;
+		float x1 = x0 + uw;
+		float y0 = currPos.y - scale * glyph.yoff;
+		float y1 = y0 - uh;
 
-		if (prevCommand.drawMode == DrawMode::LINES && prevCommand.type == RenderCommand::Type::GEOMETRY)
-		{
-			uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-			prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
+		float u0 = static_cast<float>(glyph.pos0.x) / atlasWidth;
+		float u1 = static_cast<float>(glyph.pos1.x) / atlasWidth;
+		float v0 = static_cast<float>(glyph.pos0.y) / atlasHeight;
+		float v1 = static_cast<float>(glyph.pos1.y) / atlasHeight;
 
-			for (uint32_t index = 0; index < vertices.size(); ++index)
-			{
-				vertices_[startVertexIndex + index].position = vertices[index];
-				vertices_[startVertexIndex + index].color = color;
-			}
+		vertexPtr[vertexIndex + 0].position = Vec2f(x0, y1);
+		vertexPtr[vertexIndex + 0].uv = Vec2f(u0, v1);
+		vertexPtr[vertexIndex + 0].color = color;
+		vertexPtr[vertexIndex + 0].unit = unit;
 
-			return;
-		}
-	}
+		vertexPtr[vertexIndex + 1].position = Vec2f(x1, y1);
+		vertexPtr[vertexIndex + 1].uv = Vec2f(u1, v1);
+		vertexPtr[vertexIndex + 1].color = color;
+		vertexPtr[vertexIndex + 1].unit = unit;
 
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
-	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-	}
+		vertexPtr[vertexIndex + 2].position = Vec2f(x1, y0);
+		vertexPtr[vertexIndex + 2].uv = Vec2f(u1, v0);
+		vertexPtr[vertexIndex + 2].color = color;
+		vertexPtr[vertexIndex + 2].unit = unit;
 
-	RenderCommand command;
-	command.drawMode = DrawMode::LINES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::GEOMETRY;
+		vertexPtr[vertexIndex + 3].position = Vec2f(x0, y0);
+		vertexPtr[vertexIndex + 3].uv = Vec2f(u0, v0);
+		vertexPtr[vertexIndex + 3].color = color;
+		vertexPtr[vertexIndex + 3].unit = unit;
 
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
-	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].color = color;
+		currPos.x += scale * glyph.xadvance;
+		vertexIndex += 4;
 	}
+}
 
-	commandQueue_.push(command);
+void RenderManager2D::DrawString(TextRun* textRun, const Vec2f& pos, const Vec4f& color, bool bIsCulling)
+{
+	DrawString(textRun, pos, 1.0f, color, bIsCulling);
 }
 
-void RenderManager2D::DrawSprite(ITexture* texture, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
+void RenderManager2D::DrawString(TextRun* textRun, const Vec2f& pos, float scale, const Vec4f& color, bool bIsCulling)
 {
-	static const uint32_t MAX_VERTEX_SIZE = 6;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+	CHECK(textRun != nullptr && textRun->GetFont() != nullptr);
+
+	textRun->Refresh();
+	if (textRun->quads_.empty())
 	{
-		Flush();
+		return;
 	}
 
-	float w2 = w * 0.5f;
-	float h2 = h * 0.5f;
+	float w = scale * textRun->size_.x;
+	float h = scale * textRun->size_.y;
 
-	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
+	float margin = h * 0.5f;
+	if (bIsCulling && IsCulled(Vec2f(pos.x - margin, pos.y - h - margin), Vec2f(pos.x + w + margin, pos.y + margin)))
 	{
-		Vec2f(-w2, -h2),
-		Vec2f(+w2, +h2),
-		Vec2f(-w2, +h2),
-		Vec2f(-w2, -h2),
-		Vec2f(+w2, -h2),
-		Vec2f(+w2, +h2),
-	};
+		return;
+	}
+
+	DrawGlyphQuads(textRun->font_, textRun->quads_.data(), static_cast<uint32_t>(textRun->quads_.size()), pos, scale, color);
+}
+
+void RenderManager2D::DrawString(TextLayout* textLayout, const Vec2f& pos, const Vec4f& color, bool bIsCulling)
+{
+	CHECK(textLayout != nullptr && textLayout->GetFont() != nullptr);
 
-	std::array<Vec2f, MAX_VERTEX_SIZE> uvs =
+	textLayout->Refresh();
+	if (textLayout->quads_.empty())
 	{
-		Vec2f(0.0f, 1.0f),
-		Vec2f(1.0f, 0.0f),
-		Vec2f(0.0f, 0.0f),
-		Vec2f(0.0f, 1.0f),
-		Vec2f(1.0f, 1.0f),
-		Vec2f(1.0f, 0.0f),
-	};
+		return;
+	}
 
-	Mat2x2 rotateMat = Mat2x2(
-		+GameMath::Cos(rotate), -GameMath::Sin(rotate),
-		+GameMath::Sin(rotate), +GameMath::Cos(rotate)
-	);
-	for (auto& vertex : vertices)
+	float w = GameMath::Max<float>(textLayout->boxWidth_, textLayout->size_.x);
+	float h = textLayout->size_.y;
+
+	float margin = textLayout->font_->GetLineHeight() * 0.5f;
+	if (bIsCulling && IsCulled(Vec2f(pos.x - margin, pos.y - h - margin), Vec2f(pos.x + w + margin, pos.y + margin)))
 	{
-		vertex.x = options.bIsFlipH ? -vertex.x : vertex.x;
-		vertex.y = options.bIsFlipV ? -vertex.y : vertex.y;
+		return;
+	}
 
-		vertex = rotateMat * vertex;
-		vertex += (center + PIXEL_OFFSET);
+	DrawGlyphQuads(textLayout->font_, textLayout->quads_.data(), static_cast<uint32_t>(textLayout->quads_.size()), pos, 1.0f, color);
+}
+
+void RenderManager2D::DrawGlyphQuads(TTFont* font, const GlyphQuad* quads, uint32_t count, const Vec2f& pos, float scale, const Vec4f& color)
+{
+	RenderCommand::Type type = font->IsSDF() ? RenderCommand::Type::STRING_SDF : RenderCommand::Type::STRING;
+
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(type, DrawMode::TRIANGLES, true, font, 4 * count, unit);
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		const GlyphQuad& quad = quads[index];
+
+		float x0 = pos.x + scale * quad.pos0.x;
+		float y0 = pos.y + scale * quad.pos0.y;
+		float x1 = pos.x + scale * quad.pos1.x;
+		float y1 = pos.y + scale * quad.pos1.y;
+
+		vertexPtr[0].position = Vec2f(x0, y1);
+		vertexPtr[0].uv = Vec2f(quad.uv0.x, quad.uv1.y);
+		vertexPtr[0].color = color;
+		vertexPtr[0].unit = unit;
+
+		vertexPtr[1].position = Vec2f(x1, y1);
+		vertexPtr[1].uv = quad.uv1;
+		vertexPtr[1].color = color;
+		vertexPtr[1].unit = unit;
+
+		vertexPtr[2].position = Vec2f(x1, y0);
+		vertexPtr[2].uv = Vec2f(quad.uv1.x, quad.uv0.y);
+		vertexPtr[2].color = color;
+		vertexPtr[2].unit = unit;
+
+		vertexPtr[3].position = Vec2f(x0, y0);
+		vertexPtr[3].uv = quad.uv0;
+		vertexPtr[3].color = color;
+		vertexPtr[3].unit = unit;
+
+		vertexPtr += 4;
 	}
+}
 
-	if (!commandQueue_.empty())
+void RenderManager2D::BatchRenderEntities(const Camera2D* camera, IEntity2D** entites, uint32_t count)
+{
+	Begin(camera);
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		if (prevCommand.drawMode == DrawMode::TRIANGLES && prevCommand.type == RenderCommand::Type::SPRITE)
+		for (uint32_t index = 0; index < count; ++index)
 		{
-			int32_t textureUnit = -1;
-			for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
-			{
-				if (prevCommand.texture[unit] == texture)
-				{
-					textureUnit = unit;
-					break;
-				}
-			}
+			entites[index]->Render();
+		}
+	}
+	End();
+}
 
-			if (textureUnit != -1)
-			{
-				uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-				prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
+void RenderManager2D::Flush()
+{
+	if (commandQueue_.empty()) /** Command Queue  X */
+	{
+		return;
+	}
 
-				for (uint32_t index = 0; index < vertices.size(); ++index)
-				{
-					vertices_[startVertexIndex + index].position = vertices[index];
-					vertices_[startVertexIndex + index].uv = uvs[index];
-					vertices_[startVertexIndex + index].color = Vec4f(options.blend.x, options.blend.y, options.blend.z, options.factor);
-					vertices_[startVertexIndex + index].unit = textureUnit;
-					vertices_[startVertexIndex + index].transparent = options.transparent;
-				}
+	/** ̹  [0, lastCommand.startVertexIndex + lastCommand.vertexCount)  εմϴ. */
+	const RenderCommand& lastCommand = commandQueue_.back();
+	uint32_t vertexCount = lastCommand.startVertexIndex + lastCommand.vertexCount;
 
-				return;
-			}
+	const void* vertexPtr = reinterpret_cast<const void*>(vertices_.data());
+	uint32_t bufferByteSize = static_cast<uint32_t>(Vertex::GetStride() * vertexCount);
+	vertexBuffer_->SetBufferData(vertexPtr, bufferByteSize);
 
-			for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
-			{
-				if (prevCommand.texture[unit] == nullptr)
-				{
-					textureUnit = unit;
-					break;
-				}
-			}
+	stats_.uploadByteSize += bufferByteSize;
+	stats_.flushCount++;
 
-			if (textureUnit != -1)
+	/**  ۿ  ġŭ  ε оݴϴ. */
+	uint32_t baseVertexIndex = vertexBuffer_->GetWriteOffset() / Vertex::GetStride();
+
+	GL_CHECK(glBindVertexArray(vertexArrayObject_));
+
+	Shader* shader = nullptr;
+	while (!commandQueue_.empty())
+	{
+		RenderCommand command = commandQueue_.front();
+		commandQueue_.pop();
+
+		for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
+		{
+			if (command.texture[unit])
 			{
-				uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-				prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-				prevCommand.texture[textureUnit] = texture;
+				command.texture[unit]->Active(unit);
+				stats_.stateChangeCount++;
+			}
+		}
 
-				for (uint32_t index = 0; index < vertices.size(); ++index)
-				{
-					vertices_[startVertexIndex + index].position = vertices[index];
-					vertices_[startVertexIndex + index].uv = uvs[index];
-					vertices_[startVertexIndex + index].color = Vec4f(options.blend.x, options.blend.y, options.blend.z, options.factor);
-					vertices_[startVertexIndex + index].unit = textureUnit;
-					vertices_[startVertexIndex + index].transparent = options.transparent;
-				}
+		Shader* commandShader = shaders_.at(command.type);
+		if (shader != commandShader) /** ӵ Ŀǵ尡  ̴ ϸ ٽ ε ʽϴ. */
+		{
+			shader = commandShader;
+			shader->Bind();
+			stats_.stateChangeCount++;
+		}
 
-				return;
+		stats_.drawCallCount++;
+		{
+			if (command.bIsQuad) /** 簢  4, ε 6   ε ۸  ׸ϴ. */
+			{
+				uint32_t indexCount = (command.vertexCount / 4) * 6;
+				GLint baseVertex = static_cast<GLint>(baseVertexIndex + command.startVertexIndex);
+				GL_CHECK(glDrawElementsBaseVertex(static_cast<GLenum>(command.drawMode), indexCount, GL_UNSIGNED_INT, nullptr, baseVertex));
+			}
+			else
+			{
+				GL_CHECK(glDrawArrays(static_cast<GLenum>(command.drawMode), baseVertexIndex + command.startVertexIndex, command.vertexCount));
 			}
 		}
 	}
 
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
+	if (shader)
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
+		shader->Unbind();
 	}
 
-	uint32_t textureUnit = 0;
-
-	RenderCommand command;
-	command.drawMode = DrawMode::TRIANGLES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::SPRITE;
-	command.texture[textureUnit] = texture;
+	GL_CHECK(glBindVertexArray(0));
+}
 
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
+bool RenderManager2D::IsFullCommandQueue(uint32_t vertexCount)
+{
+	if (commandQueue_.empty())
 	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].uv = uvs[index];
-		vertices_[command.startVertexIndex + index].color = Vec4f(options.blend.x, options.blend.y, options.blend.z, options.factor);
-		vertices_[command.startVertexIndex + index].unit = textureUnit;
-		vertices_[command.startVertexIndex + index].transparent = options.transparent;
+		return false;
 	}
 
-	commandQueue_.push(command);
+	const RenderCommand& command = commandQueue_.back();
+	uint32_t index = command.startVertexIndex + command.vertexCount + vertexCount;
+
+	return index >= MAX_VERTEX_BUFFER_SIZE;
 }
 
-void RenderManager2D::DrawSprite(Atlas2D* atlas, const std::string& name, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
-{	
-	static const uint32_t MAX_VERTEX_SIZE = 6;
-	if (IsFullCommandQueue(MAX_VERTEX_SIZE))
+RenderManager2D::Vertex* RenderManager2D::AllocateVertices(const RenderCommand::Type& type, const DrawMode& drawMode, bool bIsQuad, ITexture* texture, uint32_t vertexCount, uint32_t& outUnit)
+{
+	if (recordingList_) /** Ŀǵ Ʈ    Ʈ   մϴ. */
 	{
-		Flush();
+		return recordingList_->Allocate(type, drawMode, bIsQuad, texture, vertexCount, outUnit);
 	}
 
-	float w2 = w * 0.5f;
-	float h2 = h * 0.5f;
-
-	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
+	if (!bIsSorted_)
 	{
-		Vec2f(-w2, -h2),
-		Vec2f(+w2, +h2),
-		Vec2f(-w2, +h2),
-		Vec2f(-w2, -h2),
-		Vec2f(+w2, -h2),
-		Vec2f(+w2, +h2),
-	};
-
-	const Atlas2D::Block& block = atlas->GetByName(name);
-	float x0 = static_cast<float>(block.pos.x);
-	float y0 = static_cast<float>(block.pos.y);
-	float x1 = static_cast<float>(block.pos.x + block.size.x);
-	float y1 = static_cast<float>(block.pos.y + block.size.y);
-	float atlasWidth = static_cast<float>(atlas->GetWidth());
-	float atlasHeight = static_cast<float>(atlas->GetHeight());
+		uint32_t startVertexIndex = PushCommand(type, drawMode, bIsQuad, texture, vertexCount, outUnit);
+		return &vertices_[startVertexIndex];
+	}
 
-	std::array<Vec2f, MAX_VERTEX_SIZE> uvs =
+	if (sortVertexCount_ + vertexCount >= MAX_VERTEX_BUFFER_SIZE)
 	{
-		Vec2f(x0 / atlasWidth, y1 / atlasHeight),
-		Vec2f(x1 / atlasWidth, y0 / atlasHeight),
-		Vec2f(x0 / atlasWidth, y0 / atlasHeight),
-		Vec2f(x0 / atlasWidth, y1 / atlasHeight),
-		Vec2f(x1 / atlasWidth, y1 / atlasHeight),
-		Vec2f(x1 / atlasWidth, y0 / atlasHeight),
-	};
+		FlushSorted();
+	}
 
-	Mat2x2 rotateMat = Mat2x2(
-		+GameMath::Cos(rotate), -GameMath::Sin(rotate),
-		+GameMath::Sin(rotate), +GameMath::Cos(rotate)
-	);
-	for (auto& vertex : vertices)
+	uint32_t textureSlot = 0;
+	if (texture)
 	{
-		vertex.x = options.bIsFlipH ? -vertex.x : vertex.x;
-		vertex.y = options.bIsFlipV ? -vertex.y : vertex.y;
+		auto it = sortTextureSlots_.find(texture);
+		if (it == sortTextureSlots_.end())
+		{
+			textureSlot = static_cast<uint32_t>(sortTextureSlots_.size()) + 1;
+			sortTextureSlots_.insert({ texture, textureSlot });
+		}
+		else
+		{
+			textureSlot = it->second;
+		}
+	}
 
-		vertex = rotateMat * vertex;
-		vertex += (center + PIXEL_OFFSET);
+	uint64_t key = 0;
+	key |= static_cast<uint64_t>(sortLayer_) << 56;
+	key |= static_cast<uint64_t>(static_cast<uint32_t>(type) & 0xF) << 52;
+	key |= static_cast<uint64_t>(((static_cast<uint32_t>(drawMode) & 0x7) << 1) | (bIsQuad ? 1 : 0)) << 48;
+	key |= static_cast<uint64_t>(textureSlot & 0xFFFF) << 32;
+	key |= static_cast<uint64_t>(sortItems_.size());
+
+	SortItem item;
+	item.key = key;
+	item.type = type;
+	item.drawMode = drawMode;
+	item.bIsQuad = bIsQuad;
+	item.texture = texture;
+	item.startVertexIndex = sortVertexCount_;
+	item.vertexCount = vertexCount;
+	sortItems_.push_back(item);
+
+	sortVertexCount_ += vertexCount;
+
+	outUnit = 0; /** ؽó    ٽ մϴ. */
+	return &vertices_[item.startVertexIndex];
+}
+
+uint32_t RenderManager2D::PushCommand(const RenderCommand::Type& type, const DrawMode& drawMode, bool bIsQuad, ITexture* texture, uint32_t vertexCount, uint32_t& outUnit)
+{
+	if (IsFullCommandQueue(vertexCount))
+	{
+		Flush();
 	}
-	
+
+	outUnit = 0;
 	if (!commandQueue_.empty())
 	{
 		RenderCommand& prevCommand = commandQueue_.back();
-		if (prevCommand.drawMode == DrawMode::TRIANGLES && prevCommand.type == RenderCommand::Type::SPRITE)
+		if (prevCommand.drawMode == drawMode && prevCommand.type == type && prevCommand.bIsQuad == bIsQuad)
 		{
 			int32_t textureUnit = -1;
-			for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
+			if (texture == nullptr) /** ؽó  ʴ´ٸ ٷ մϴ. */
 			{
-				if (prevCommand.texture[unit] == atlas)
-				{
-					textureUnit = unit;
-					break;
-				}
+				textureUnit = 0;
 			}
-
-			if (textureUnit != -1)
+			else if (type == RenderCommand::Type::SPRITE_ARRAY) /** ̴ 0 ָ øϹǷ  ؽó 迭  մϴ. */
 			{
-				uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-				prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-
-				for (uint32_t index = 0; index < vertices.size(); ++index)
+				textureUnit = (prevCommand.texture[0] == texture) ? 0 : -1;
+			}
+			else
+			{
+				for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
 				{
-					vertices_[startVertexIndex + index].position = vertices[index];
-					vertices_[startVertexIndex + index].uv = uvs[index];
-					vertices_[startVertexIndex + index].color = Vec4f(options.blend.x, options.blend.y, options.blend.z, options.factor);
-					vertices_[startVertexIndex + index].unit = textureUnit;
-					vertices_[startVertexIndex + index].transparent = options.transparent;
+					if (prevCommand.texture[unit] == texture)
+					{
+						textureUnit = unit;
+						break;
+					}
 				}
 
-				return;
-			}
-
-			for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
-			{
-				if (prevCommand.texture[unit] == nullptr)
+				for (uint32_t unit = 0; textureUnit == -1 && unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
 				{
-					textureUnit = unit;
-					break;
+					if (prevCommand.texture[unit] == nullptr)
+					{
+						textureUnit = unit;
+						prevCommand.texture[unit] = texture;
+					}
 				}
 			}
 
 			if (textureUnit != -1)
 			{
 				uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-				prevCommand.vertexCount += static_cast<uint32_t>(vertices.size());
-				prevCommand.texture[textureUnit] = atlas;
-
-				for (uint32_t index = 0; index < vertices.size(); ++index)
-				{
-					vertices_[startVertexIndex + index].position = vertices[index];
-					vertices_[startVertexIndex + index].uv = uvs[index];
-					vertices_[startVertexIndex + index].color = Vec4f(options.blend.x, options.blend.y, options.blend.z, options.factor);
-					vertices_[startVertexIndex + index].unit = textureUnit;
-					vertices_[startVertexIndex + index].transparent = options.transparent;
-				}
+				prevCommand.vertexCount += vertexCount;
 
-				return;
+				outUnit = static_cast<uint32_t>(textureUnit);
+				return startVertexIndex;
 			}
 		}
 	}
@@ -1324,231 +1287,332 @@ void RenderManager2D::DrawSprite(Atlas2D* atlas, const std::string& name, const
 		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
 	}
 
-	uint32_t textureUnit = 0;
-
 	RenderCommand command;
-	command.drawMode = DrawMode::TRIANGLES;
+	command.drawMode = drawMode;
 	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = static_cast<uint32_t>(vertices.size());
-	command.type = RenderCommand::Type::SPRITE;
-	command.texture[textureUnit] = atlas;
-
-	for (uint32_t index = 0; index < command.vertexCount; ++index)
-	{
-		vertices_[command.startVertexIndex + index].position = vertices[index];
-		vertices_[command.startVertexIndex + index].uv = uvs[index];
-		vertices_[command.startVertexIndex + index].color = Vec4f(options.blend.x, options.blend.y, options.blend.z, options.factor);
-		vertices_[command.startVertexIndex + index].unit = textureUnit;
-		vertices_[command.startVertexIndex + index].transparent = options.transparent;
-	}
+	command.vertexCount = vertexCount;
+	command.type = type;
+	command.bIsQuad = bIsQuad;
+	command.texture[0] = texture;
 
 	commandQueue_.push(command);
+
+	return startVertexIndex;
 }
 
-void RenderManager2D::DrawString(TTFont* font, const std::wstring& text, const Vec2f& pos, const Vec4f& color)
-{	
-	/**  ϳ  6. */
-	uint32_t vertexCount = 6 * static_cast<uint32_t>(text.size());
-	if (IsFullCommandQueue(vertexCount))
+
+void RenderManager2D::DrawSpriteQuad(const RenderCommand::Type& type, ITexture* texture, int32_t layer, const std::array<Vec2f, 4>& uvs, const Vec2f& center, float w, float h, float rotate, const SpriteRenderOptions& options)
+{
+	if (options.bIsCulling && IsCulled(center, 0.5f * GameMath::Sqrt(w * w + h * h)))
 	{
-		Flush();
+		return;
 	}
 
-	float w = 0.0f;
-	float h = 0.0f;
-	font->MeasureText(text, w, h);
+	static const uint32_t MAX_VERTEX_SIZE = 4;
 
-	float atlasWidth = static_cast<float>(font->GetAtlasWidth());
-	float atlasHeight = static_cast<float>(font->GetAtlasHeight());
-	Vec2f currPos = Vec2f(pos.x, pos.y - h);
+	float w2 = w * 0.5f;
+	float h2 = h * 0.5f;
 
-	auto composeVertexData = [&](uint32_t vertexIndex, uint32_t unit)
-		{
-			for (const auto& unicode : text)
-			{
-				const Glyph& glyph = font->GetGlyph(static_cast<int32_t>(unicode));
-
-				float uw = static_cast<float>(glyph.pos1.x - glyph.pos0.x);
-				float uh = static_cast<float>(glyph.pos1.y - glyph.pos0.y);
-
-				vertices_[vertexIndex + 0].position = Vec2f(currPos.x + glyph.xoff, currPos.y - glyph.yoff);
-				vertices_[vertexIndex + 0].uv = Vec2f(static_cast<float>(glyph.pos0.x) / atlasWidth, static_cast<float>(glyph.pos0.y) / atlasHeight);
-				vertices_[vertexIndex + 0].color = color;
-				vertices_[vertexIndex + 0].unit = unit;
-
-				vertices_[vertexIndex + 1].position = Vec2f(currPos.x + glyph.xoff, currPos.y - uh - glyph.yoff);
-				vertices_[vertexIndex + 1].uv = Vec2f(static_cast<float>(glyph.pos0.x) / atlasWidth, static_cast<float>(glyph.pos1.y) / atlasHeight);
-				vertices_[vertexIndex + 1].color = color;
-				vertices_[vertexIndex + 1].unit = unit;
-
-				vertices_[vertexIndex + 2].position = Vec2f(currPos.x + uw + glyph.xoff, currPos.y - glyph.yoff);
-				vertices_[vertexIndex + 2].uv = Vec2f(static_cast<float>(glyph.pos1.x) / atlasWidth, static_cast<float>(glyph.pos0.y) / atlasHeight);
-				vertices_[vertexIndex + 2].color = color;
-				vertices_[vertexIndex + 2].unit = unit;
-
-				vertices_[vertexIndex + 3].position = Vec2f(currPos.x + uw + glyph.xoff, currPos.y - glyph.yoff);
-				vertices_[vertexIndex + 3].uv = Vec2f(static_cast<float>(glyph.pos1.x) / atlasWidth, static_cast<float>(glyph.pos0.y) / atlasHeight);
-				vertices_[vertexIndex + 3].color = color;
-				vertices_[vertexIndex + 3].unit = unit;
-
-				vertices_[vertexIndex + 4].position = Vec2f(currPos.x + glyph.xoff, currPos.y - uh - glyph.yoff);
-				vertices_[vertexIndex + 4].uv = Vec2f(static_cast<float>(glyph.pos0.x) / atlasWidth, static_cast<float>(glyph.pos1.y) / atlasHeight);
-				vertices_[vertexIndex + 4].color = color;
-				vertices_[vertexIndex + 4].unit = unit;
-
-				vertices_[vertexIndex + 5].position = Vec2f(currPos.x + uw + glyph.xoff, currPos.y - uh - glyph.yoff);
-				vertices_[vertexIndex + 5].uv = Vec2f(static_cast<float>(glyph.pos1.x) / atlasWidth, static_cast<float>(glyph.pos1.y) / atlasHeight);
-				vertices_[vertexIndex + 5].color = color;
-				vertices_[vertexIndex + 5].unit = unit;
-
-				currPos.x += glyph.xadvance;
-				vertexIndex += 6;
-			}
-		};
+	std::array<Vec2f, MAX_VERTEX_SIZE> vertices =
+	{
+		Vec2f(-w2, -h2),
+		Vec2f(+w2, -h2),
+		Vec2f(+w2, +h2),
+		Vec2f(-w2, +h2),
+	};
 
+	Mat2x2 rotateMat = Mat2x2(
+		+GameMath::Cos(rotate), -GameMath::Sin(rotate),
+		+GameMath::Sin(rotate), +GameMath::Cos(rotate)
+	);
+	for (auto& vertex : vertices)
+	{
+		vertex.x = options.bIsFlipH ? -vertex.x : vertex.x;
+		vertex.y = options.bIsFlipV ? -vertex.y : vertex.y;
 
-	if (!commandQueue_.empty())
+		vertex = rotateMat * vertex;
+		vertex += (center + PIXEL_OFFSET);
+	}
+
+	uint32_t unit = 0;
+	Vertex* vertexPtr = AllocateVertices(type, DrawMode::TRIANGLES, true, texture, static_cast<uint32_t>(vertices.size()), unit);
+
+	/** ؽó 迭 ׻ 0 ֿ εǹǷ ؽó   ̾ ε մϴ. */
+	uint32_t unitOrLayer = (layer >= 0) ? static_cast<uint32_t>(layer) : unit;
+	for (uint32_t index = 0; index < vertices.size(); ++index)
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
+		vertexPtr[index].position = vertices[index];
+		vertexPtr[index].uv = uvs[index];
+		vertexPtr[index].color = Vec4f(options.blend.x, options.blend.y, options.blend.z, options.factor);
+		vertexPtr[index].unit = unitOrLayer;
+		vertexPtr[index].transparent = options.transparent;
+	}
+}
 
-		if (prevCommand.drawMode == DrawMode::TRIANGLES && prevCommand.type == RenderCommand::Type::STRING)
+void RenderManager2D::FlushSorted()
+{
+	if (sortItems_.empty())
+	{
+		return;
+	}
+
+	/**   ״   ο ݰ    մϴ. */
+	const SortItem* prevItem = nullptr;
+	std::array<const ITexture*, RenderCommand::MAX_TEXTURE_UNIT> boundTextures = { nullptr, };
+	uint32_t boundTextureCount = 0;
+	for (const auto& item : sortItems_)
+	{
+		bool bIsMerge = prevItem && prevItem->type == item.type && prevItem->drawMode == item.drawMode && prevItem->bIsQuad == item.bIsQuad;
+		bool bIsBound = (item.texture == nullptr) || (std::find(boundTextures.begin(), boundTextures.begin() + boundTextureCount, item.texture) != boundTextures.begin() + boundTextureCount);
+		if (bIsMerge && (bIsBound || boundTextureCount < RenderCommand::MAX_TEXTURE_UNIT))
 		{
-			int32_t atlasUnit = -1;
-			for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
+			if (!bIsBound)
 			{
-				if (prevCommand.font[unit] == font)
-				{
-					atlasUnit = unit;
-					break;
-				}
+				boundTextures[boundTextureCount++] = item.texture;
+				stats_.unsortedStateChangeCount++;
 			}
+		}
+		else
+		{
+			stats_.unsortedDrawCallCount++;
+			stats_.unsortedStateChangeCount += (!prevItem || prevItem->type != item.type) ? 1 : 0;
+			stats_.unsortedStateChangeCount += item.texture ? 1 : 0;
 
-			if (atlasUnit != -1)
+			boundTextureCount = 0;
+			if (item.texture)
 			{
-				uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-				prevCommand.vertexCount += vertexCount;
-
-				composeVertexData(startVertexIndex, atlasUnit);
-				return;
+				boundTextures[boundTextureCount++] = item.texture;
 			}
+		}
 
-			for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
-			{
-				if (prevCommand.font[unit] == nullptr)
-				{
-					atlasUnit = unit;
-					break;
-				}
-			}
+		prevItem = &item;
+	}
 
-			if (atlasUnit != -1)
-			{
-				uint32_t startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
-				prevCommand.vertexCount += vertexCount;
-				prevCommand.font[atlasUnit] = font;
+	/** 8Ʈ  LSD  Դϴ.  ׸   ڸ ǳʶݴϴ. */
+	sortScratch_.resize(sortItems_.size());
+	for (uint32_t shift = 0; shift < 64; shift += 8)
+	{
+		std::array<uint32_t, 256> counts = { 0, };
+		for (const auto& item : sortItems_)
+		{
+			counts[(item.key >> shift) & 0xFF]++;
+		}
 
-				composeVertexData(startVertexIndex, atlasUnit);
-				return;
-			}
+		if (counts[(sortItems_.front().key >> shift) & 0xFF] == sortItems_.size())
+		{
+			continue;
 		}
+
+		uint32_t offset = 0;
+		for (auto& count : counts)
+		{
+			uint32_t current = count;
+			count = offset;
+			offset += current;
+		}
+
+		for (const auto& item : sortItems_)
+		{
+			sortScratch_[counts[(item.key >> shift) & 0xFF]++] = item;
+		}
+
+		sortItems_.swap(sortScratch_);
 	}
 
-	uint32_t startVertexIndex = 0;
-	if (!commandQueue_.empty())
+	/** ϵ  ĵ  ٽ ġϸ鼭 Ŀǵ带 մϴ. */
+	sortVertices_.assign(vertices_.begin(), vertices_.begin() + sortVertexCount_);
+	for (const auto& item : sortItems_)
 	{
-		RenderCommand& prevCommand = commandQueue_.back();
-		startVertexIndex = prevCommand.startVertexIndex + prevCommand.vertexCount;
+		uint32_t unit = 0;
+		uint32_t startVertexIndex = PushCommand(item.type, item.drawMode, item.bIsQuad, item.texture, item.vertexCount, unit);
+		CopyVertices(item.type, unit, &sortVertices_[item.startVertexIndex], item.vertexCount, &vertices_[startVertexIndex]);
 	}
 
-	uint32_t atlasUnit = 0;
+	sortItems_.clear();
+	sortTextureSlots_.clear();
+	sortVertexCount_ = 0;
 
-	RenderCommand command;
-	command.drawMode = DrawMode::TRIANGLES;
-	command.startVertexIndex = startVertexIndex;
-	command.vertexCount = vertexCount;
-	command.type = RenderCommand::Type::STRING;
-	command.font[atlasUnit] = font;
+	Flush();
+}
+
+void RenderManager2D::Submit(RenderCommandList2D** lists, uint32_t count)
+{
+	CHECK(bIsBegin_);
+	CHECK(recordingList_ == nullptr);
+
+	uint8_t sortLayer = sortLayer_;
+	for (uint32_t listIndex = 0; listIndex < count; ++listIndex)
+	{
+		const RenderCommandList2D* list = lists[listIndex];
+		CHECK(list != nullptr && !list->bIsRecording_);
 
-	composeVertexData(command.startVertexIndex, atlasUnit);
+		stats_.culledCount += list->stats_.culledCount;
+		stats_.acceptedCount += list->stats_.acceptedCount;
 
-	commandQueue_.push(command);
+		for (const auto& item : list->items_)
+		{
+			sortLayer_ = item.sortLayer;
+
+			uint32_t unit = 0;
+			Vertex* vertexPtr = AllocateVertices(item.type, item.drawMode, item.bIsQuad, item.texture, item.vertexCount, unit);
+			CopyVertices(item.type, unit, &list->vertices_[item.startVertexIndex], item.vertexCount, vertexPtr);
+		}
+	}
+	sortLayer_ = sortLayer;
 }
 
-void RenderManager2D::BatchRenderEntities(const Camera2D* camera, IEntity2D** entites, uint32_t count)
+void RenderManager2D::CopyVertices(const RenderCommand::Type& type, uint32_t unit, const Vertex* srcVertexPtr, uint32_t vertexCount, Vertex* dstVertexPtr)
 {
-	Begin(camera);
+	std::copy(srcVertexPtr, srcVertexPtr + vertexCount, dstVertexPtr);
+
+	/** ؽó    Ŀǵ忡  ޶Ƿ ٽ մϴ. ؽó 迭 ̾ ε մϴ. */
+	if (type == RenderCommand::Type::SPRITE || type == RenderCommand::Type::STRING || type == RenderCommand::Type::STRING_SDF)
 	{
-		for (uint32_t index = 0; index < count; ++index)
+		for (uint32_t index = 0; index < vertexCount; ++index)
 		{
-			entites[index]->Render();
+			dstVertexPtr[index].unit = unit;
 		}
 	}
-	End();
 }
 
-void RenderManager2D::Flush()
+void RenderManager2D::SetCullBounds(const Camera2D* camera, bool& bOutHasBounds, Vec2f& outMinPos, Vec2f& outMaxPos)
 {
-	if (commandQueue_.empty()) /** Command Queue  X */
+	bOutHasBounds = (camera != nullptr);
+	if (!bOutHasBounds)
 	{
 		return;
 	}
 
-	const void* vertexPtr = reinterpret_cast<const void*>(vertices_.data());
-	uint32_t bufferByteSize = static_cast<uint32_t>(Vertex::GetStride() * vertices_.size());
-	vertexBuffer_->SetBufferData(vertexPtr, bufferByteSize);
+	const Vec2f& center = camera->GetCenter();
+	const Vec2f& size = camera->GetSize();
+	outMinPos = Vec2f(center.x - size.x * 0.5f, center.y - size.y * 0.5f);
+	outMaxPos = Vec2f(center.x + size.x * 0.5f, center.y + size.y * 0.5f);
+}
 
-	GL_CHECK(glBindVertexArray(vertexArrayObject_));
+bool RenderManager2D::IsCulled(const Vec2f& minPos, const Vec2f& maxPos)
+{
+	bool bHasBounds = bHasCullBounds_;
+	const Vec2f* cullMinPos = &cullMinPos_;
+	const Vec2f* cullMaxPos = &cullMaxPos_;
+	Stats* stats = &stats_;
+	if (recordingList_) /** ٸ 忡  ̶ Ʈ ī޶  踦 մϴ. */
+	{
+		bHasBounds = recordingList_->bHasCullBounds_;
+		cullMinPos = &recordingList_->cullMinPos_;
+		cullMaxPos = &recordingList_->cullMaxPos_;
+		stats = &recordingList_->stats_;
+	}
 
-	while (!commandQueue_.empty())
+	if (!bHasBounds)
 	{
-		RenderCommand command = commandQueue_.front();
-		commandQueue_.pop();
+		return false;
+	}
 
-		switch (command.type)
-		{
-		case RenderCommand::Type::SPRITE:
-			for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
-			{
-				if (command.texture[unit])
-				{
-					command.texture[unit]->Active(unit);
-				}
-			}
-			break;
+	bool bIsCulled = (maxPos.x < cullMinPos->x || minPos.x > cullMaxPos->x || maxPos.y < cullMinPos->y || minPos.y > cullMaxPos->y);
+	if (bIsCulled)
+	{
+		stats->culledCount++;
+	}
+	else
+	{
+		stats->acceptedCount++;
+	}
 
-		case RenderCommand::Type::STRING:
-			for (uint32_t unit = 0; unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
-			{
-				if (command.font[unit])
-				{
-					command.font[unit]->Active(unit);
-				}
-			}
-			break;
-		}
+	return bIsCulled;
+}
 
-		Shader* shader = shaders_.at(command.type);
-		shader->Bind();
-		{
-			GL_CHECK(glDrawArrays(static_cast<GLenum>(command.drawMode), command.startVertexIndex, command.vertexCount));
-		}
-		shader->Unbind();
+bool RenderManager2D::IsCulled(const Vec2f& center, float radius)
+{
+	return IsCulled(Vec2f(center.x - radius, center.y - radius), Vec2f(center.x + radius, center.y + radius));
+}
+
+bool RenderManager2D::IsCulled(const Vec2f& pos0, const Vec2f& pos1, const Vec2f& pos2)
+{
+	Vec2f minPos = Vec2f(GameMath::Min(pos0.x, GameMath::Min(pos1.x, pos2.x)), GameMath::Min(pos0.y, GameMath::Min(pos1.y, pos2.y)));
+	Vec2f maxPos = Vec2f(GameMath::Max(pos0.x, GameMath::Max(pos1.x, pos2.x)), GameMath::Max(pos0.y, GameMath::Max(pos1.y, pos2.y)));
+	return IsCulled(minPos, maxPos);
+}
+
+uint32_t RenderManager2D::CalculateSliceLevel(float pixelLength, uint32_t minSliceCount)
+{
+	/** (chord) ȣ  ִ   0.25 ȼ ǵ ϴ ü      * sqrt(2r) Դϴ. */
+	float sliceCount = PI * GameMath::Sqrt(2.0f * GameMath::Max<float>(pixelLength, 0.0f));
+	if (minSliceCount == MIN_CORNER_SLICE_SIZE)
+	{
+		sliceCount *= 0.25f; /** 𼭸  1/4Դϴ. */
 	}
 
-	GL_CHECK(glBindVertexArray(0));
+	uint32_t level = 0;
+	while (level + 1 < MAX_SLICE_LEVEL && static_cast<float>(minSliceCount << level) < sliceCount)
+	{
+		level++;
+	}
+
+	return level;
 }
 
-bool RenderManager2D::IsFullCommandQueue(uint32_t vertexCount)
+uint32_t RenderManager2D::CalculateCircleOutline(const Vec2f& center, float radius, Vec2f* outOutline)
 {
-	if (commandQueue_.empty())
+	uint32_t level = CalculateSliceLevel(radius * pixelScale_, MIN_CIRCLE_SLICE_SIZE);
+	uint32_t sliceCount = MIN_CIRCLE_SLICE_SIZE << level;
+	const float* tablePtr = &CIRCLE_TABLE[2 * GetTableOffset(MIN_CIRCLE_SLICE_SIZE, level)];
+
+	TransformPoints(tablePtr, sliceCount + 1, Vec2f(radius, radius), 1.0f, 0.0f, center + PIXEL_OFFSET, outOutline);
+
+	return sliceCount;
+}
+
+uint32_t RenderManager2D::CalculateRoundRectOutline(const Vec2f& center, float w, float h, float side, float rotate, Vec2f* outOutline)
+{
+	float w2 = w * 0.5f;
+	float h2 = h * 0.5f;
+	side = GameMath::Min<float>(side, GameMath::Min<float>(h2, h2));
+
+	uint32_t level = CalculateSliceLevel(side * pixelScale_, MIN_CORNER_SLICE_SIZE);
+	uint32_t sliceCount = MIN_CORNER_SLICE_SIZE << level;
+	const float* tablePtr = &CORNER_TABLE[2 * GetTableOffset(MIN_CORNER_SLICE_SIZE, level)];
+
+	/** », ϴ, ϴ,   𼭸   / Դϴ. */
+	const std::array<Vec2f, 4> controls = { Vec2f(-w2, +h2), Vec2f(-w2, -h2), Vec2f(+w2, -h2), Vec2f(+w2, +h2), };
+	const std::array<Vec2f, 4> starts = { Vec2f(+1.0f, 0.0f), Vec2f(0.0f, +1.0f), Vec2f(-1.0f, 0.0f), Vec2f(0.0f, -1.0f), };
+	const std::array<Vec2f, 4> ends = { Vec2f(0.0f, -1.0f), Vec2f(+1.0f, 0.0f), Vec2f(0.0f, +1.0f), Vec2f(-1.0f, 0.0f), };
+
+	uint32_t outlineCount = 0;
+	for (uint32_t corner = 0; corner < controls.size(); ++corner)
 	{
-		return false;
+		const Vec2f& control = controls[corner];
+		Vec2f start = Vec2f(starts[corner].x * side, starts[corner].y * side);
+		Vec2f end = Vec2f(ends[corner].x * side, ends[corner].y * side);
+
+		for (uint32_t slice = 0; slice <= sliceCount; ++slice)
+		{
+			float a = tablePtr[2 * slice + 0];
+			float b = tablePtr[2 * slice + 1];
+			outOutline[outlineCount++] = Vec2f(control.x + start.x * a + end.x * b, control.y + start.y * a + end.y * b);
+		}
 	}
 
-	const RenderCommand& command = commandQueue_.back();
-	uint32_t index = command.startVertexIndex + command.vertexCount + vertexCount;
+	TransformPoints(reinterpret_cast<const float*>(outOutline), outlineCount, Vec2f(1.0f, 1.0f), GameMath::Cos(rotate), GameMath::Sin(rotate), center + PIXEL_OFFSET, outOutline);
 
-	return index >= MAX_VERTEX_BUFFER_SIZE;
+	return outlineCount;
+}
+
+void RenderManager2D::SetVertexAttributes()
+{
+	GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, position))));
+	GL_CHECK(glEnableVertexAttribArray(0));
+
+	GL_CHECK(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, uv))));
+	GL_CHECK(glEnableVertexAttribArray(1));
+
+	GL_CHECK(glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, color))));
+	GL_CHECK(glEnableVertexAttribArray(2));
+
+	GL_CHECK(glVertexAttribIPointer(3, 1, GL_INT, Vertex::GetStride(), (void*)(offsetof(Vertex, unit))));
+	GL_CHECK(glEnableVertexAttribArray(3));
+
+	GL_CHECK(glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, transparent))));
+	GL_CHECK(glEnableVertexAttribArray(4));
 }
 
 #pragma warning(pop)
\ No newline at end of file
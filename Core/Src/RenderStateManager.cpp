@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <SDL2/SDL.h>
 
 #include <glad/glad.h>
@@ -8,6 +10,7 @@
 
 #include "Assertion.h"
 #include "Config.h"
+#include "NullGL.h"
 #include "RenderStateManager.h"
 
 RenderStateManager RenderStateManager::instance_;
@@ -22,23 +25,30 @@ RenderStateManager* RenderStateManager::GetPtr()
 	return &instance_;
 }
 
+template <>
+void RenderStateManager::GetScreenSize(int32_t& outWidth, int32_t& outHeight)
+{
+	if (bIsHeadless_)
+	{
+		outWidth = headlessSize_.x;
+		outHeight = headlessSize_.y;
+		return;
+	}
+
+	SDL_GetWindowSize(reinterpret_cast<SDL_Window*>(window_), &outWidth, &outHeight);
+}
+
 template <>
 void RenderStateManager::GetScreenSize(float& outWidth, float& outHeight)
 {
 	int32_t w = 0;
 	int32_t h = 0;
-	SDL_GetWindowSize(reinterpret_cast<SDL_Window*>(window_), &w, &h);
+	GetScreenSize<int32_t>(w, h);
 
 	outWidth = static_cast<float>(w);
 	outHeight = static_cast<float>(h);
 }
 
-template <>
-void RenderStateManager::GetScreenSize(int32_t& outWidth, int32_t& outHeight)
-{
-	SDL_GetWindowSize(reinterpret_cast<SDL_Window*>(window_), &outWidth, &outHeight);
-}
-
 int32_t RenderStateManager::GetNumVideoDisplay()
 {
 	return numVideoDisplay_;
@@ -65,6 +75,11 @@ void RenderStateManager::SetWindowViewport()
 
 void RenderStateManager::SetVsyncMode(bool bIsEnable)
 {
+	if (bIsHeadless_)
+	{
+		return;
+	}
+
 	ASSERT(SDL_GL_SetSwapInterval(static_cast<int32_t>(bIsEnable)) == 0, "%s", SDL_GetError());
 }
 
@@ -148,6 +163,11 @@ void RenderStateManager::BeginFrame(float red, float green, float blue, float al
 
 void RenderStateManager::EndFrame()
 {
+	if (bIsHeadless_)
+	{
+		return;
+	}
+
 	ImGui::Render();
 	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
@@ -222,8 +242,24 @@ void RenderStateManager::PostStartup()
 	ASSERT(ImGui_ImplOpenGL3_Init(), "Failed to initialzie ImGui for OpenGL.");
 }
 
+void RenderStateManager::HeadlessStartup(int32_t width, int32_t height)
+{
+	bIsHeadless_ = true;
+	headlessSize_ = Vec2i(width, height);
+
+	numVideoDisplay_ = 1;
+	displaySizes_ = { headlessSize_ };
+
+	NullGL::Load();
+}
+
 void RenderStateManager::Shutdown()
 {
+	if (bIsHeadless_)
+	{
+		return;
+	}
+
 	ImGui_ImplOpenGL3_Shutdown();
 	ImGui_ImplSDL2_Shutdown();
 	ImGui::DestroyContext();
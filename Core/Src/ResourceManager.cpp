@@ -1,8 +1,42 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include <glad/glad.h>
+#include <stb_image.h>
+
 #include "Assertion.h"
 #include "ResourceManager.h"
+#include "Texture2D.h"
+#include "TextureFile.h"
 
 ResourceManager ResourceManager::instance_;
 
+/** Ŀ 尡 ڵϴ ؽó ۾Դϴ. state bIsCanceled     ٲ ʽϴ. */
+struct ResourceManager::AsyncTexture
+{
+	enum class State : int32_t
+	{
+		DECODING = 0x00,
+		DECODED  = 0x01,
+		FAILED   = 0x02,
+	};
+
+	std::string path;
+	ITexture::Filter filter;
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+
+	uint32_t pixelBufferID = 0;
+	uint8_t* mappedPtr = nullptr; /**  忡  PBO ޸Դϴ. Ŀ ⿡ ϴ. */
+	std::size_t byteSize = 0;
+
+	Texture2D* texture = nullptr; /**   Դϴ. ε  ıǸ nullptr ˴ϴ. */
+	std::atomic<bool> bIsCanceled = false;
+	std::atomic<State> state = State::DECODING;
+};
+
 ResourceManager& ResourceManager::GetRef()
 {
 	return instance_;
@@ -13,86 +47,307 @@ ResourceManager* ResourceManager::GetPtr()
 	return &instance_;
 }
 
-void ResourceManager::Destroy(const IResource* resource)
+Texture2D* ResourceManager::CreateTexture2DAsync(const std::string& path, const ITexture::Filter& filter)
 {
-	int32_t resourceID = -1;
-	for (uint32_t index = 0; index < size_; ++index)
+	if (TextureFile::IsTextureFilePath(path))
 	{
-		IResource* resourcePtr = resources_[index].get();
-		if (resource == resourcePtr)
-		{
-			resourceID = static_cast<int32_t>(index);
-			break;
-		}
+		return Create<Texture2D>(path, filter);
 	}
 
-	if (resourceID != -1 && resources_[resourceID])
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+	ASSERT(stbi_info(path.c_str(), &width, &height, &channels), "failed to load %s file", path.c_str());
+
+	Texture2D* texture = new Texture2D();
+	Insert(std::unique_ptr<IResource>(texture));
+
+	std::shared_ptr<AsyncTexture> asyncTexture = std::make_shared<AsyncTexture>();
+	asyncTexture->path = path;
+	asyncTexture->filter = filter;
+	asyncTexture->width = width;
+	asyncTexture->height = height;
+	asyncTexture->channels = channels;
+	asyncTexture->byteSize = static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * static_cast<std::size_t>(channels);
+	asyncTexture->texture = texture;
+
+	GLsizeiptr byteSize = static_cast<GLsizeiptr>(asyncTexture->byteSize);
+	GL_CHECK(glGenBuffers(1, &asyncTexture->pixelBufferID));
+	GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, asyncTexture->pixelBufferID));
+	GL_CHECK(glBufferData(GL_PIXEL_UNPACK_BUFFER, byteSize, nullptr, GL_STREAM_DRAW));
+	GL_CHECK(asyncTexture->mappedPtr = reinterpret_cast<uint8_t*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, byteSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT)));
+	GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+	ASSERT(asyncTexture->mappedPtr != nullptr, "Failed to map pixel buffer for '%s' file.", path.c_str());
+
+	asyncTextures_.push_back(asyncTexture);
+
+	if (workers_.empty())
+	{
+		StartupWorkers();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(jobMutex_);
+		jobs_.push(asyncTexture);
+	}
+	jobCondition_.notify_one();
+
+	return texture;
+}
+
+void ResourceManager::UploadAsyncTextures()
+{
+	for (auto it = asyncTextures_.begin(); it != asyncTextures_.end();)
 	{
-		Unregister(resource);
+		AsyncTexture* asyncTexture = it->get();
+
+		AsyncTexture::State state = asyncTexture->state.load(std::memory_order_acquire);
+		if (state == AsyncTexture::State::DECODING)
+		{
+			++it;
+			continue;
+		}
+
+		GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, asyncTexture->pixelBufferID));
+		GL_CHECK(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
 
-		if (resources_[resourceID]->IsInitialized())
+		if (asyncTexture->texture)
 		{
-			resources_[resourceID]->Release();
+			ASSERT(state == AsyncTexture::State::DECODED, "failed to load %s file", asyncTexture->path.c_str());
+			asyncTexture->texture->CreateTextureFromPixelBuffer(asyncTexture->width, asyncTexture->height, asyncTexture->channels, asyncTexture->filter);
 		}
 
-		resources_[resourceID].reset();
-		usage_[resourceID] = false;
+		GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+		GL_CHECK(glDeleteBuffers(1, &asyncTexture->pixelBufferID));
+
+		it = asyncTextures_.erase(it);
+	}
+}
+
+void ResourceManager::FlushAsyncTextures()
+{
+	while (!asyncTextures_.empty())
+	{
+		UploadAsyncTextures();
+		std::this_thread::yield();
+	}
+}
+
+void ResourceManager::Destroy(const IResource* resource)
+{
+	if (IsManaged(resource))
+	{
+		Remove(resource->resourceSlot_);
 	}
 }
 
-void ResourceManager::Register(const std::string& name, IResource* resource)
+void ResourceManager::Register(const NameID& name, IResource* resource)
 {
-	auto it = resourceCache_.find(name);
-	ASSERT(it == resourceCache_.end(), "Already register '%s'", name.c_str());
+	bool bIsInserted = resourceCache_.Insert(name, resource);
+	ASSERT(bIsInserted, "Already register name(0x%016llX)", static_cast<unsigned long long>(name.GetHash()));
 
-	resourceCache_.insert({ name, resource });
+	if (IsManaged(resource))
+	{
+		slots_[resource->resourceSlot_].names.push_back(name);
+	}
 }
 
-bool ResourceManager::IsRegistration(const std::string& name)
+bool ResourceManager::IsRegistration(const NameID& name)
 {
-	return resourceCache_.find(name) != resourceCache_.end();
+	return resourceCache_.Contains(name);
 }
 
-void ResourceManager::Unregister(const std::string& name)
+void ResourceManager::Unregister(const NameID& name)
 {
-	auto it = resourceCache_.find(name);
-	ASSERT(it != resourceCache_.end(), "Can't find '%s' in ResourceManager.", name.c_str());
+	IResource** resourcePtr = resourceCache_.Find(name);
+	ASSERT(resourcePtr != nullptr, "Can't find name(0x%016llX) in ResourceManager.", static_cast<unsigned long long>(name.GetHash()));
 
-	resourceCache_.erase(it);
+	IResource* resource = *resourcePtr;
+	if (IsManaged(resource))
+	{
+		std::vector<NameID>& names = slots_[resource->resourceSlot_].names;
+		names.erase(std::find(names.begin(), names.end(), name));
+	}
+
+	resourceCache_.Erase(name);
 }
 
 void ResourceManager::Unregister(const IResource* resource)
 {
-	std::string name;
-	for (const auto& resourceCache : resourceCache_)
+	if (!IsManaged(resource))
+	{
+		return;
+	}
+
+	std::vector<NameID>& names = slots_[resource->resourceSlot_].names;
+	for (const auto& name : names)
+	{
+		resourceCache_.Erase(name);
+	}
+	names.clear();
+}
+
+bool ResourceManager::IsManaged(const IResource* resource) const
+{
+	if (!resource)
+	{
+		return false;
+	}
+
+	uint32_t slot = resource->resourceSlot_;
+	return slot < slots_.size() && slots_[slot].resource.get() == resource;
+}
+
+void ResourceManager::Insert(std::unique_ptr<IResource> resource)
+{
+	uint32_t slot = freeSlot_;
+	if (slot != ResourceHandle<IResource>::INVALID_INDEX)
+	{
+		freeSlot_ = slots_[slot].nextFreeSlot;
+		slots_[slot].nextFreeSlot = ResourceHandle<IResource>::INVALID_INDEX;
+	}
+	else
 	{
-		if (resourceCache.second == resource)
+		slot = static_cast<uint32_t>(slots_.size());
+		slots_.emplace_back();
+	}
+
+	resource->resourceSlot_ = slot;
+	slots_[slot].resource = std::move(resource);
+	resourceCount_++;
+}
+
+void ResourceManager::Remove(uint32_t slot)
+{
+	IResource* resource = slots_[slot].resource.get();
+
+	/** ε  񵿱 ؽó ۾ մϴ.   ۾ ŭ Ȯմϴ. */
+	for (auto& asyncTexture : asyncTextures_)
+	{
+		if (asyncTexture->texture == resource)
 		{
-			name = resourceCache.first;
+			asyncTexture->texture = nullptr;
+			asyncTexture->bIsCanceled.store(true, std::memory_order_relaxed);
 		}
 	}
 
-	if (!name.empty())
+	Unregister(resource);
+
+	if (resource->IsInitialized())
 	{
-		Unregister(name);
+		resource->Release();
+	}
+
+	slots_[slot].resource.reset();
+	slots_[slot].generation++;
+	slots_[slot].nextFreeSlot = freeSlot_;
+	freeSlot_ = slot;
+	resourceCount_--;
+}
+
+void ResourceManager::StartupWorkers()
+{
+	uint32_t threadCount = std::thread::hardware_concurrency();
+	uint32_t workerCount = (threadCount > 1) ? (threadCount - 1) : 1; /**    ϴ. */
+
+	bIsStopWorkers_ = false;
+	for (uint32_t index = 0; index < workerCount; ++index)
+	{
+		workers_.emplace_back([this]() { RunWorker(); });
+	}
+}
+
+void ResourceManager::ShutdownWorkers()
+{
+	{
+		std::lock_guard<std::mutex> lock(jobMutex_);
+		bIsStopWorkers_ = true;
+	}
+	jobCondition_.notify_all();
+
+	for (auto& worker : workers_)
+	{
+		worker.join();
+	}
+	workers_.clear();
+
+	while (!jobs_.empty())
+	{
+		jobs_.front()->state.store(AsyncTexture::State::FAILED, std::memory_order_release);
+		jobs_.pop();
+	}
+}
+
+void ResourceManager::RunWorker()
+{
+	while (true)
+	{
+		std::shared_ptr<AsyncTexture> asyncTexture = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(jobMutex_);
+			jobCondition_.wait(lock, [this]() { return bIsStopWorkers_ || !jobs_.empty(); });
+
+			if (bIsStopWorkers_)
+			{
+				return;
+			}
+
+			asyncTexture = jobs_.front();
+			jobs_.pop();
+		}
+
+		if (asyncTexture->bIsCanceled.load(std::memory_order_relaxed))
+		{
+			asyncTexture->state.store(AsyncTexture::State::FAILED, std::memory_order_release);
+			continue;
+		}
+
+		/** stb_image ܺ ۷  ڵ  Ƿ, ڵ  ε PBO   մϴ. */
+		int32_t width = 0;
+		int32_t height = 0;
+		int32_t channels = 0;
+		uint8_t* imagePtr = stbi_load(asyncTexture->path.c_str(), &width, &height, &channels, asyncTexture->channels);
+
+		bool bSucceed = (imagePtr != nullptr) && (width == asyncTexture->width) && (height == asyncTexture->height);
+		if (bSucceed)
+		{
+			std::memcpy(asyncTexture->mappedPtr, imagePtr, asyncTexture->byteSize);
+		}
+
+		if (imagePtr)
+		{
+			stbi_image_free(imagePtr);
+		}
+
+		asyncTexture->state.store(bSucceed ? AsyncTexture::State::DECODED : AsyncTexture::State::FAILED, std::memory_order_release);
 	}
 }
 
 void ResourceManager::Cleanup()
 {
-	for (std::size_t index = 0; index < size_; ++index)
+	ShutdownWorkers();
+
+	for (auto& asyncTexture : asyncTextures_)
+	{
+		asyncTexture->texture = nullptr;
+	}
+	UploadAsyncTextures();
+
+	for (auto& slot : slots_)
 	{
-		if (resources_[index])
+		if (slot.resource)
 		{
-			if (resources_[index]->IsInitialized())
+			if (slot.resource->IsInitialized())
 			{
-				resources_[index]->Release();
+				slot.resource->Release();
 			}
 
-			resources_[index].reset();
-			usage_[index] = false;
+			slot.resource.reset();
 		}
 	}
 
-	size_ = 0;
+	slots_.clear();
+	freeSlot_ = ResourceHandle<IResource>::INVALID_INDEX;
+	resourceCount_ = 0;
+	resourceCache_.Clear();
 }
\ No newline at end of file
@@ -13,10 +13,14 @@ SpriteAnim2D::SpriteAnim2D(Atlas2D* atlas, const std::vector<std::string>& clipN
 		float rate = static_cast<float>(index) / static_cast<float>(clips_.size());
 
 		clips_[index].name = clipNames[index];
+		clips_[index].spriteID = atlas_->Find(clipNames[index]);
 		clips_[index].time = animationTime_ * rate;
+
+		CHECK(clips_[index].spriteID != Atlas2D::INVALID_SPRITE_ID);
 	}
 
 	clips_.back().name = clips_.front().name;
+	clips_.back().spriteID = clips_.front().spriteID;
 	clips_.back().time = animationTime_;
 
 	bIsInitialized_ = true;
@@ -0,0 +1,158 @@
+#include <glad/glad.h>
+
+#include "Assertion.h"
+#include "IndexBuffer.h"
+#include "ResourceManager.h"
+#include "StaticBatch2D.h"
+#include "TTFont.h"
+#include "VertexBuffer.h"
+
+ResourceManager* StaticBatch2D::resourceMgr_ = nullptr;
+
+StaticBatch2D::StaticBatch2D()
+{
+	if (!resourceMgr_)
+	{
+		resourceMgr_ = ResourceManager::GetPtr();
+	}
+
+	GL_CHECK(glGenVertexArrays(1, &vertexArrayObject_));
+
+	bIsInitialized_ = true;
+}
+
+StaticBatch2D::~StaticBatch2D()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void StaticBatch2D::Release()
+{
+	CHECK(bIsInitialized_);
+
+	if (vertexBuffer_)
+	{
+		resourceMgr_->Destroy(vertexBuffer_);
+		vertexBuffer_ = nullptr;
+	}
+
+	GL_CHECK(glDeleteVertexArrays(1, &vertexArrayObject_));
+
+	segments_.clear();
+	vertexCount_ = 0;
+
+	bIsInitialized_ = false;
+}
+
+void StaticBatch2D::Begin(const Camera2D* camera)
+{
+	commandList_.Begin(camera);
+}
+
+void StaticBatch2D::End()
+{
+	commandList_.End();
+
+	Bake();
+	bIsDirty_ = false;
+}
+
+void StaticBatch2D::Bake()
+{
+	using RenderCommand = RenderManager2D::RenderCommand;
+	using Vertex = RenderManager2D::Vertex;
+
+	segments_.clear();
+	vertexCount_ = commandList_.GetVertexCount();
+
+	std::vector<Vertex> vertices(vertexCount_);
+	for (const auto& item : commandList_.items_)
+	{
+		if (item.type == RenderCommand::Type::STRING || item.type == RenderCommand::Type::STRING_SDF)
+		{
+			ASSERT(!static_cast<const TTFont*>(item.texture)->IsDynamic(), "Static batch can not bake text of dynamic font. Glyph cache may evict its glyphs.");
+		}
+
+		int32_t textureUnit = -1;
+		if (!segments_.empty())
+		{
+			RenderCommand& prevSegment = segments_.back();
+			bool bCanMerge = prevSegment.type == item.type
+				&& prevSegment.drawMode == item.drawMode
+				&& prevSegment.bIsQuad == item.bIsQuad
+				&& prevSegment.vertexCount + item.vertexCount < RenderManager2D::MAX_VERTEX_BUFFER_SIZE; /**  ε    ʵ մϴ. */
+
+			if (bCanMerge && item.type == RenderCommand::Type::SPRITE_ARRAY) /** ̴ 0 ָ øϹǷ  ؽó 迭  մϴ. */
+			{
+				textureUnit = (prevSegment.texture[0] == item.texture) ? 0 : -1;
+				bCanMerge = false;
+			}
+
+			for (uint32_t unit = 0; bCanMerge && textureUnit == -1 && unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
+			{
+				if (item.texture == nullptr || prevSegment.texture[unit] == item.texture)
+				{
+					textureUnit = unit;
+				}
+			}
+
+			for (uint32_t unit = 0; bCanMerge && textureUnit == -1 && unit < RenderCommand::MAX_TEXTURE_UNIT; ++unit)
+			{
+				if (prevSegment.texture[unit] == nullptr)
+				{
+					textureUnit = unit;
+					prevSegment.texture[unit] = item.texture;
+				}
+			}
+
+			if (textureUnit != -1)
+			{
+				prevSegment.vertexCount += item.vertexCount;
+			}
+		}
+
+		if (textureUnit == -1)
+		{
+			textureUnit = 0;
+
+			RenderCommand segment;
+			segment.type = item.type;
+			segment.drawMode = item.drawMode;
+			segment.bIsQuad = item.bIsQuad;
+			segment.startVertexIndex = segments_.empty() ? 0 : segments_.back().startVertexIndex + segments_.back().vertexCount;
+			segment.vertexCount = item.vertexCount;
+			segment.texture[0] = item.texture;
+			segments_.push_back(segment);
+		}
+
+		uint32_t dstVertexIndex = segments_.back().startVertexIndex + segments_.back().vertexCount - item.vertexCount;
+		RenderManager2D::CopyVertices(item.type, textureUnit, &commandList_.vertices_[item.startVertexIndex], item.vertexCount, &vertices[dstVertexIndex]);
+	}
+
+	if (vertexBuffer_)
+	{
+		resourceMgr_->Destroy(vertexBuffer_);
+		vertexBuffer_ = nullptr;
+	}
+
+	if (vertexCount_ == 0)
+	{
+		return;
+	}
+
+	uint32_t byteSize = static_cast<uint32_t>(Vertex::GetStride() * vertexCount_);
+	vertexBuffer_ = resourceMgr_->Create<VertexBuffer>(vertices.data(), byteSize, VertexBuffer::Usage::STATIC);
+
+	GL_CHECK(glBindVertexArray(vertexArrayObject_));
+	{
+		vertexBuffer_->Bind();
+		RenderManager2D::SetVertexAttributes();
+		vertexBuffer_->Unbind();
+
+		RenderManager2D::GetRef().quadIndexBuffer_->Bind();
+	}
+	GL_CHECK(glBindVertexArray(0));
+}
\ No newline at end of file
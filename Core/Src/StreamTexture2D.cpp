@@ -0,0 +1,171 @@
+#include <algorithm>
+
+#include <glad/glad.h>
+
+#include "Assertion.h"
+#include "MappedFile.h"
+#include "RenderStateManager.h"
+#include "StreamTexture2D.h"
+#include "TextureStreamer.h"
+
+StreamTexture2D::StreamTexture2D(const std::string& path, const Filter& filter)
+{
+	file_ = std::make_shared<MappedFile>(path);
+
+	std::string message;
+	bool bSucceed = TextureFile::Parse(path, file_->GetData(), file_->GetSize(), desc_, message);
+	ASSERT(bSucceed, "Failed to load '%s' file. %s", path.c_str(), message.c_str());
+	ASSERT(!desc_.bGenerateMipmap, "Stream texture '%s' must contain its mip chain.", path.c_str());
+
+	if (desc_.format.extension)
+	{
+		bool bHasExt = RenderStateManager::GetRef().HasGLExtension(desc_.format.extension);
+		ASSERT(bHasExt, "This hardware does not support '%s'.", desc_.format.extension);
+	}
+
+	pinnedLevel_ = desc_.levelCount - 1;
+	for (uint32_t level = 0; level < desc_.levelCount; ++level)
+	{
+		const TextureFile::Level& mip = desc_.levels[level];
+		if (mip.width <= MAX_PINNED_SIZE && mip.height <= MAX_PINNED_SIZE)
+		{
+			pinnedLevel_ = level;
+			break;
+		}
+	}
+
+	GLint minFilter = static_cast<GLint>(filter);
+	if (desc_.levelCount > 1)
+	{
+		minFilter = (filter == Filter::NEAREST) ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
+	}
+
+	GL_CHECK(glGenTextures(1, &textureID_));
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D, textureID_));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(filter)));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(desc_.levelCount - 1)));
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+	/**  Ӻ ÷ BASE_LEVEL ߴ  ؽó ׻  ¸ մϴ. */
+	residentLevel_ = desc_.levelCount;
+	for (int32_t level = static_cast<int32_t>(desc_.levelCount) - 1; level >= static_cast<int32_t>(pinnedLevel_); --level)
+	{
+		UploadLevel(level, file_->GetData() + desc_.levels[level].offset);
+	}
+
+	targetLevel_ = pinnedLevel_;
+
+	TextureStreamer::GetRef().Register(this);
+
+	bIsInitialized_ = true;
+}
+
+StreamTexture2D::~StreamTexture2D()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void StreamTexture2D::Release()
+{
+	CHECK(bIsInitialized_);
+
+	TextureStreamer::GetRef().Unregister(this);
+
+	GL_CHECK(glDeleteTextures(1, &textureID_));
+	file_.reset();
+
+	bIsInitialized_ = false;
+}
+
+void StreamTexture2D::Active(uint32_t unit) const
+{
+	GL_CHECK(glActiveTexture(GL_TEXTURE0 + unit));
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D, textureID_));
+}
+
+void StreamTexture2D::RequestSize(float screenWidth, float screenHeight)
+{
+	float ratioX = static_cast<float>(desc_.width) / std::max<float>(screenWidth, 1.0f);
+	float ratioY = static_cast<float>(desc_.height) / std::max<float>(screenHeight, 1.0f);
+	float ratio = std::min<float>(ratioX, ratioY);
+
+	/** ؼ ȭ ȼ  2谡    ܰ   մϴ. */
+	uint32_t level = 0;
+	while (ratio >= 2.0f && level < pinnedLevel_)
+	{
+		ratio *= 0.5f;
+		++level;
+	}
+
+	/** RenderCommandList2D ϴ  尡 ÿ   Ƿ  ּڰ ϴ. */
+	uint32_t requestedLevel = requestedLevel_.load(std::memory_order_relaxed);
+	while (level < requestedLevel && !requestedLevel_.compare_exchange_weak(requestedLevel, level, std::memory_order_relaxed))
+	{
+	}
+}
+
+std::size_t StreamTexture2D::GetResidentByteSize() const
+{
+	std::size_t byteSize = 0;
+	for (uint32_t level = residentLevel_; level < desc_.levelCount; ++level)
+	{
+		byteSize += desc_.levels[level].size;
+	}
+
+	return byteSize;
+}
+
+void StreamTexture2D::UploadLevel(uint32_t level, const void* pixels)
+{
+	CHECK(level + 1 == residentLevel_);
+
+	const TextureFile::Level& mip = desc_.levels[level];
+
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D, textureID_));
+	GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
+	if (desc_.format.bIsCompressed)
+	{
+		GL_CHECK(glCompressedTexImage2D(GL_TEXTURE_2D, level, desc_.format.internalFormat, mip.width, mip.height, 0, static_cast<GLsizei>(mip.size), pixels));
+	}
+	else
+	{
+		GL_CHECK(glTexImage2D(GL_TEXTURE_2D, level, desc_.format.internalFormat, mip.width, mip.height, 0, desc_.format.format, desc_.format.type, pixels));
+	}
+
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(level)));
+	GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+	residentLevel_ = level;
+}
+
+void StreamTexture2D::EvictLevel()
+{
+	CHECK(residentLevel_ < pinnedLevel_);
+
+	uint32_t level = residentLevel_;
+
+	/** BASE_LEVEL  ø  0x0 ̹ ٽ  ش    մϴ. */
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D, textureID_));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(level + 1)));
+
+	if (desc_.format.bIsCompressed)
+	{
+		GL_CHECK(glCompressedTexImage2D(GL_TEXTURE_2D, level, desc_.format.internalFormat, 0, 0, 0, 0, nullptr));
+	}
+	else
+	{
+		GL_CHECK(glTexImage2D(GL_TEXTURE_2D, level, desc_.format.internalFormat, 0, 0, 0, desc_.format.format, desc_.format.type, nullptr));
+	}
+
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+
+	residentLevel_ = level + 1;
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include <vector>
+
+#include "RenderManager2D.h"
+#include "System2D.h"
+#include "World.h"
+
+void System2D::Move(World& world, float deltaSeconds)
+{
+	world.Query<Transform2D, Velocity2D>([&](uint32_t count, Transform2D* transforms, Velocity2D* velocities)
+		{
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				transforms[index].position.x += velocities[index].linear.x * deltaSeconds;
+				transforms[index].position.y += velocities[index].linear.y * deltaSeconds;
+				transforms[index].rotate += velocities[index].angular * deltaSeconds;
+			}
+		}
+	);
+}
+
+void System2D::RenderSprites(World& world)
+{
+	static std::vector<RenderManager2D::SpriteInstance> instances;
+	RenderManager2D* render2dMgr = RenderManager2D::GetPtr();
+
+	ITexture* texture = nullptr;
+	auto flush = [&]()
+		{
+			if (texture && !instances.empty())
+			{
+				render2dMgr->DrawSpriteInstanced(texture, instances.data(), static_cast<uint32_t>(instances.size()));
+			}
+			instances.clear();
+		};
+
+	world.Query<Transform2D, Sprite2D>([&](uint32_t count, Transform2D* transforms, Sprite2D* sprites)
+		{
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				if (sprites[index].texture != texture)
+				{
+					flush();
+					texture = sprites[index].texture;
+				}
+
+				RenderManager2D::SpriteInstance instance;
+				instance.center = transforms[index].position;
+				instance.size = transforms[index].size;
+				instance.SetRotate(transforms[index].rotate);
+				instance.SetTransparent(sprites[index].transparent);
+				instance.SetUV(sprites[index].uv0, sprites[index].uv1);
+
+				instances.push_back(instance);
+			}
+		}
+	);
+
+	flush();
+}
\ No newline at end of file
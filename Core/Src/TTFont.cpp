@@ -1,6 +1,8 @@
 #pragma warning(push)
 #pragma warning(disable: 26451)
 
+#include <algorithm>
+
 #include <glad/glad.h>
 #include <stb_rect_pack.h>
 #include <stb_truetype.h>
@@ -9,6 +11,23 @@
 #include "GameUtils.h"
 #include "TTFont.h"
 
+/**  ĳÿ ۸ ̿ δ Դϴ.  ͸  ̿ ۸  ʵ մϴ. */
+static const int32_t GLYPH_PADDING = 1;
+
+/**  ĳ  ̴    ø   ۸   ϰ մϴ. */
+static const int32_t SHELF_HEIGHT_ALIGNMENT = 4;
+
+/** SDF ۸ ܰ (ȼ)Դϴ.   Ÿ Ÿ  մϴ. */
+static const int32_t SDF_PADDING = 4;
+
+/** SDF   شϴ Դϴ. ̴ 0.5  մϴ. */
+static const uint8_t SDF_ON_EDGE_VALUE = 128;
+
+/** 1ȼ Ÿ SDF  ȭԴϴ.   0 Ǵ 255 ǵ ϴ. */
+static const float SDF_PIXEL_DIST_SCALE = static_cast<float>(SDF_ON_EDGE_VALUE) / static_cast<float>(SDF_PADDING);
+
+std::atomic<uint64_t> TTFont::generation_ = 1;
+
 TTFont::TTFont(const std::string& path, int32_t beginCodePoint, int32_t endCodePoint, float fontSize)
 	: beginCodePoint_(beginCodePoint)
 	, endCodePoint_(endCodePoint)
@@ -20,8 +39,35 @@ TTFont::TTFont(const std::string& path, int32_t beginCodePoint, int32_t endCodeP
 	const uint8_t* bufferPtr = reinterpret_cast<const uint8_t*>(buffer.data());
 	ASSERT((stbtt_InitFont(&info, bufferPtr, stbtt_GetFontOffsetForIndex(bufferPtr, 0)) != 0), "Failed to initialize stb_truetype font.");
 
+	LoadMetrics(&info, stbtt_ScaleForPixelHeight(&info, fontSize_), beginCodePoint_, endCodePoint_);
+
 	std::shared_ptr<uint8_t[]> bitmap = CreateGlyphAtlasBitmap(buffer);
-	atlasID_ = CreateGlyphAtlasResource(bitmap);
+	atlasID_ = CreateGlyphAtlasResource(bitmap.get());
+
+	bIsInitialized_ = true;
+}
+
+TTFont::TTFont(const std::string& path, float fontSize, int32_t atlasSize, bool bIsSDF)
+	: fontSize_(fontSize)
+	, atlasWidth_(atlasSize)
+	, atlasHeight_(atlasSize)
+	, bIsDynamic_(true)
+	, bIsSDF_(bIsSDF)
+{
+	fontBuffer_ = GameUtils::ReadFile(path);
+	fontInfo_ = std::make_unique<stbtt_fontinfo>();
+
+	const uint8_t* bufferPtr = reinterpret_cast<const uint8_t*>(fontBuffer_.data());
+	ASSERT((stbtt_InitFont(fontInfo_.get(), bufferPtr, stbtt_GetFontOffsetForIndex(bufferPtr, 0)) != 0), "Failed to initialize stb_truetype font.");
+
+	fontScale_ = stbtt_ScaleForPixelHeight(fontInfo_.get(), fontSize_);
+	LoadMetrics(fontInfo_.get(), fontScale_, 0x0000, 0xFFFF); /**  ĳô     Ƿ ⺻ ٱ  ü Ŀ մϴ. */
+
+	atlasBitmap_ = std::vector<uint8_t>(atlasWidth_ * atlasHeight_, 0);
+	dirtyMinY_ = atlasHeight_;
+	dirtyMaxY_ = 0;
+
+	atlasID_ = CreateGlyphAtlasResource(atlasBitmap_.data());
 
 	bIsInitialized_ = true;
 }
@@ -47,18 +93,72 @@ void TTFont::Active(uint32_t unit) const
 {
 	GL_CHECK(glActiveTexture(GL_TEXTURE0 + unit));
 	GL_CHECK(glBindTexture(GL_TEXTURE_2D, atlasID_));
+
+	if (!bIsDynamic_)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (dirtyMinY_ < dirtyMaxY_) /**  ε   ٸ մϴ. */
+	{
+		const void* bufferPtr = reinterpret_cast<const void*>(&atlasBitmap_[dirtyMinY_ * atlasWidth_]);
+
+		GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+		GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, dirtyMinY_, atlasWidth_, dirtyMaxY_ - dirtyMinY_, GL_RED, GL_UNSIGNED_BYTE, bufferPtr));
+
+		dirtyMinY_ = atlasHeight_;
+		dirtyMaxY_ = 0;
+	}
 }
 
-const Glyph& TTFont::GetGlyph(int32_t codePoint) const
+Glyph TTFont::GetGlyph(int32_t codePoint) const
 {
+	if (bIsDynamic_)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return CacheGlyph(codePoint);
+	}
+
 	CHECK(IsValidCodePoint(codePoint));
 
-	int32_t index = codePoint - beginCodePoint_;
-	return glyphs_[index];
+	auto it = glyphs_.find(codePoint);
+	CHECK(it != glyphs_.end());
+
+	return it->second;
+}
+
+float TTFont::GetKerning(int32_t leftCodePoint, int32_t rightCodePoint) const
+{
+	if (kernings_.empty())
+	{
+		return 0.0f;
+	}
+
+	uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(leftCodePoint)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(rightCodePoint));
+	auto it = kernings_.find(key);
+
+	return (it != kernings_.end()) ? it->second : 0.0f;
+}
+
+uint64_t TTFont::GetEvictionCount() const
+{
+	if (!bIsDynamic_)
+	{
+		return 0;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	return evictionCount_;
 }
 
 bool TTFont::IsValidCodePoint(int32_t codePoint) const
 {
+	if (bIsDynamic_)
+	{
+		return stbtt_FindGlyphIndex(fontInfo_.get(), codePoint) != 0;
+	}
+
 	return (beginCodePoint_ <= codePoint) && (codePoint <= endCodePoint_);
 }
 
@@ -70,7 +170,7 @@ void TTFont::MeasureText(const std::wstring& text, float& outWidth, float& outHe
 
 	for (uint32_t index = 0; index < text.size(); ++index)
 	{
-		const Glyph& glyph = GetGlyph(static_cast<int32_t>(text[index]));
+		Glyph glyph = GetGlyph(static_cast<int32_t>(text[index]));
 
 		if (index == text.size() - 1)
 		{
@@ -92,12 +192,66 @@ void TTFont::MeasureText(const std::wstring& text, float& outWidth, float& outHe
 	outHeight = static_cast<float>(GameMath::Abs(maxY - minY));
 }
 
+void TTFont::LoadMetrics(const stbtt_fontinfo* info, float scale, int32_t beginCodePoint, int32_t endCodePoint)
+{
+	int32_t ascent = 0;
+	int32_t descent = 0;
+	int32_t lineGap = 0;
+	stbtt_GetFontVMetrics(info, &ascent, &descent, &lineGap);
+
+	ascent_ = scale * static_cast<float>(ascent);
+	descent_ = scale * static_cast<float>(descent);
+	lineGap_ = scale * static_cast<float>(lineGap);
+
+	int32_t kerningSize = stbtt_GetKerningTableLength(info);
+	if (kerningSize <= 0)
+	{
+		return;
+	}
+
+	std::vector<stbtt_kerningentry> entries(kerningSize);
+	kerningSize = stbtt_GetKerningTable(info, entries.data(), kerningSize);
+
+	/** Ŀ ǥ ۸ ε ̹Ƿ,   ڵ Ʈ ǵ ǥ  ϴ. */
+	std::unordered_map<int32_t, std::vector<int32_t>> glyphCodePoints;
+	for (int32_t codePoint = beginCodePoint; codePoint <= endCodePoint; ++codePoint)
+	{
+		int32_t glyph = stbtt_FindGlyphIndex(info, codePoint);
+		if (glyph != 0)
+		{
+			glyphCodePoints[glyph].push_back(codePoint);
+		}
+	}
+
+	for (int32_t index = 0; index < kerningSize; ++index)
+	{
+		const stbtt_kerningentry& entry = entries[index];
+
+		auto left = glyphCodePoints.find(entry.glyph1);
+		auto right = glyphCodePoints.find(entry.glyph2);
+		if (left == glyphCodePoints.end() || right == glyphCodePoints.end() || entry.advance == 0)
+		{
+			continue;
+		}
+
+		float advance = scale * static_cast<float>(entry.advance);
+		for (const auto& leftCodePoint : left->second)
+		{
+			for (const auto& rightCodePoint : right->second)
+			{
+				uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(leftCodePoint)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(rightCodePoint));
+				kernings_.insert({ key, advance });
+			}
+		}
+	}
+}
+
 std::shared_ptr<uint8_t[]> TTFont::CreateGlyphAtlasBitmap(const std::vector<uint8_t>& buffer)
 {
 	std::size_t glyphSize = static_cast<std::size_t>(endCodePoint_ - beginCodePoint_ + 1);
 
 	std::vector<stbtt_packedchar> packedchars(glyphSize);
-	glyphs_ = std::vector<Glyph>(glyphSize);
+	glyphs_.reserve(glyphSize);
 
 	atlasWidth_ = 16;
 	atlasHeight_ = 16;
@@ -137,20 +291,23 @@ std::shared_ptr<uint8_t[]> TTFont::CreateGlyphAtlasBitmap(const std::vector<uint
 	ASSERT(bitmap != nullptr, "Failed to create glyph atlas from stb_truetype.");
 	for (std::size_t index = 0; index < packedchars.size(); ++index)
 	{
-		glyphs_[index].codePoint = static_cast<int32_t>(index + beginCodePoint_);
-		glyphs_[index].pos0 = Vec2i(packedchars[index].x0, packedchars[index].y0);
-		glyphs_[index].pos1 = Vec2i(packedchars[index].x1, packedchars[index].y1);
-		glyphs_[index].xoff = packedchars[index].xoff;
-		glyphs_[index].yoff = packedchars[index].yoff;
-		glyphs_[index].xoff2 = packedchars[index].xoff2;
-		glyphs_[index].yoff2 = packedchars[index].yoff2;
-		glyphs_[index].xadvance = packedchars[index].xadvance;
+		Glyph glyph;
+		glyph.codePoint = static_cast<int32_t>(index + beginCodePoint_);
+		glyph.pos0 = Vec2i(packedchars[index].x0, packedchars[index].y0);
+		glyph.pos1 = Vec2i(packedchars[index].x1, packedchars[index].y1);
+		glyph.xoff = packedchars[index].xoff;
+		glyph.yoff = packedchars[index].yoff;
+		glyph.xoff2 = packedchars[index].xoff2;
+		glyph.yoff2 = packedchars[index].yoff2;
+		glyph.xadvance = packedchars[index].xadvance;
+
+		glyphs_.insert({ glyph.codePoint, glyph });
 	}
 
 	return bitmap;
 }
 
-uint32_t TTFont::CreateGlyphAtlasResource(const std::shared_ptr<uint8_t[]>& bitmap)
+uint32_t TTFont::CreateGlyphAtlasResource(const uint8_t* bitmap)
 {
 	uint32_t atlasID;
 
@@ -163,7 +320,7 @@ uint32_t TTFont::CreateGlyphAtlasResource(const std::shared_ptr<uint8_t[]>& bitm
 	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
 	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
 
-	const void* bufferPtr = reinterpret_cast<const void*>(&bitmap[0]);
+	const void* bufferPtr = reinterpret_cast<const void*>(bitmap);
 	GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, atlasWidth_, atlasHeight_, 0, GL_RED, GL_UNSIGNED_BYTE, bufferPtr));
 
 	GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
@@ -171,4 +328,203 @@ uint32_t TTFont::CreateGlyphAtlasResource(const std::shared_ptr<uint8_t[]>& bitm
 	return atlasID;
 }
 
+Glyph TTFont::GetGlyph(int32_t codePoint, uint32_t& outShelf) const
+{
+	if (!bIsDynamic_)
+	{
+		outShelf = 0;
+		return GetGlyph(codePoint);
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	Glyph glyph = CacheGlyph(codePoint);
+	outShelf = glyphShelves_.at(codePoint);
+
+	return glyph;
+}
+
+bool TTFont::TouchShelves(const std::vector<uint32_t>& shelves, uint64_t evictionCount) const
+{
+	if (!bIsDynamic_)
+	{
+		return true;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (evictionCount_ != evictionCount)
+	{
+		return false;
+	}
+
+	for (const auto& shelf : shelves)
+	{
+		shelves_[shelf].lastUseGeneration = generation_;
+	}
+
+	return true;
+}
+
+Glyph TTFont::CacheGlyph(int32_t codePoint) const
+{
+	auto it = glyphs_.find(codePoint);
+	if (it != glyphs_.end())
+	{
+		shelves_[glyphShelves_.at(codePoint)].lastUseGeneration = generation_;
+		return it->second;
+	}
+
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t x0 = 0;
+	int32_t y0 = 0;
+	uint8_t* sdfBitmap = nullptr;
+
+	if (bIsSDF_)
+	{
+		sdfBitmap = stbtt_GetCodepointSDF(fontInfo_.get(), fontScale_, codePoint, SDF_PADDING, SDF_ON_EDGE_VALUE, SDF_PIXEL_DIST_SCALE, &width, &height, &x0, &y0);
+		if (!sdfBitmap) /** ó   ۸Դϴ. */
+		{
+			width = 0;
+			height = 0;
+			x0 = 0;
+			y0 = 0;
+		}
+	}
+	else
+	{
+		int32_t x1 = 0;
+		int32_t y1 = 0;
+		stbtt_GetCodepointBitmapBox(fontInfo_.get(), codePoint, fontScale_, fontScale_, &x0, &y0, &x1, &y1);
+
+		width = x1 - x0;
+		height = y1 - y0;
+	}
+
+	int32_t advance = 0;
+	int32_t leftSideBearing = 0;
+	stbtt_GetCodepointHMetrics(fontInfo_.get(), codePoint, &advance, &leftSideBearing);
+
+	uint32_t shelfIndex = AllocateShelf(width + GLYPH_PADDING, height + GLYPH_PADDING);
+
+	Shelf& shelf = shelves_[shelfIndex];
+	int32_t x = shelf.cursor;
+	int32_t y = shelf.y;
+
+	shelf.cursor += width + GLYPH_PADDING;
+	shelf.lastUseGeneration = generation_;
+	shelf.codePoints.push_back(codePoint);
+
+	if (width > 0 && height > 0)
+	{
+		uint8_t* bitmapPtr = &atlasBitmap_[y * atlasWidth_ + x];
+		if (sdfBitmap)
+		{
+			for (int32_t row = 0; row < height; ++row)
+			{
+				std::copy(sdfBitmap + row * width, sdfBitmap + (row + 1) * width, bitmapPtr + row * atlasWidth_);
+			}
+		}
+		else
+		{
+			stbtt_MakeCodepointBitmap(fontInfo_.get(), bitmapPtr, width, height, atlasWidth_, fontScale_, fontScale_, codePoint);
+		}
+
+		dirtyMinY_ = GameMath::Min<int32_t>(dirtyMinY_, y);
+		dirtyMaxY_ = GameMath::Max<int32_t>(dirtyMaxY_, y + height);
+	}
+
+	if (sdfBitmap)
+	{
+		stbtt_FreeSDF(sdfBitmap, nullptr);
+	}
+
+	Glyph glyph;
+	glyph.codePoint = codePoint;
+	glyph.pos0 = Vec2i(x, y);
+	glyph.pos1 = Vec2i(x + width, y + height);
+	glyph.xoff = static_cast<float>(x0);
+	glyph.yoff = static_cast<float>(y0);
+	glyph.xoff2 = static_cast<float>(x0 + width);
+	glyph.yoff2 = static_cast<float>(y0 + height);
+	glyph.xadvance = fontScale_ * static_cast<float>(advance);
+
+	glyphShelves_.insert({ codePoint, shelfIndex });
+	glyphs_.insert({ codePoint, glyph });
+
+	return glyph;
+}
+
+uint32_t TTFont::AllocateShelf(int32_t width, int32_t height) const
+{
+	ASSERT(width <= atlasWidth_ && height <= atlasHeight_, "Glyph is larger than glyph cache atlas.");
+
+	/** 1.      ̰   ´  ãϴ. */
+	uint32_t bestIndex = static_cast<uint32_t>(shelves_.size());
+	for (uint32_t index = 0; index < shelves_.size(); ++index)
+	{
+		const Shelf& shelf = shelves_[index];
+		if (shelf.height < height || shelf.height > 2 * height || atlasWidth_ - shelf.cursor < width)
+		{
+			continue;
+		}
+
+		if (bestIndex == shelves_.size() || shelf.height < shelves_[bestIndex].height)
+		{
+			bestIndex = index;
+		}
+	}
+
+	if (bestIndex < shelves_.size())
+	{
+		return bestIndex;
+	}
+
+	/** 2. Ʋ Ʒʿ   ִٸ   ϴ. */
+	int32_t shelfHeight = ((height + SHELF_HEIGHT_ALIGNMENT - 1) / SHELF_HEIGHT_ALIGNMENT) * SHELF_HEIGHT_ALIGNMENT;
+	int32_t shelfY = shelves_.empty() ? 0 : (shelves_.back().y + shelves_.back().height);
+	if (shelfY + shelfHeight <= atlasHeight_)
+	{
+		Shelf shelf;
+		shelf.y = shelfY;
+		shelf.height = shelfHeight;
+
+		shelves_.push_back(shelf);
+		return static_cast<uint32_t>(shelves_.size() - 1);
+	}
+
+	/** 3.  ׷  ۸         ϴ. */
+	for (uint32_t index = 0; index < shelves_.size(); ++index)
+	{
+		const Shelf& shelf = shelves_[index];
+		if (shelf.height < height || shelf.lastUseGeneration >= generation_)
+		{
+			continue;
+		}
+
+		if (bestIndex == shelves_.size() || shelf.lastUseGeneration < shelves_[bestIndex].lastUseGeneration)
+		{
+			bestIndex = index;
+		}
+	}
+
+	ASSERT(bestIndex < shelves_.size(), "Glyph cache is full. Increase atlas size of dynamic font.");
+
+	Shelf& shelf = shelves_[bestIndex];
+	for (const auto& codePoint : shelf.codePoints)
+	{
+		glyphs_.erase(codePoint);
+		glyphShelves_.erase(codePoint);
+	}
+
+	shelf.codePoints.clear();
+	shelf.cursor = 0;
+	evictionCount_++;
+
+	std::fill(atlasBitmap_.begin() + shelf.y * atlasWidth_, atlasBitmap_.begin() + (shelf.y + shelf.height) * atlasWidth_, 0);
+	dirtyMinY_ = GameMath::Min<int32_t>(dirtyMinY_, shelf.y);
+	dirtyMaxY_ = GameMath::Max<int32_t>(dirtyMaxY_, shelf.y + shelf.height);
+
+	return bestIndex;
+}
+
 #pragma warning(pop)
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include <algorithm>
+
+#include "Assertion.h"
+#include "TextLayout.h"
+
+void TextLayout::SetFont(TTFont* font, float boxWidth, const Align& align)
+{
+	if (font_ == font && boxWidth_ == boxWidth && align_ == align)
+	{
+		return;
+	}
+
+	font_ = font;
+	boxWidth_ = boxWidth;
+	align_ = align;
+
+	Relayout(0);
+}
+
+void TextLayout::SetText(const std::wstring& text)
+{
+	if (text_ == text)
+	{
+		return;
+	}
+
+	auto mismatch = std::mismatch(text_.begin(), text_.end(), text.begin(), text.end());
+	uint32_t changedIndex = static_cast<uint32_t>(mismatch.first - text_.begin());
+
+	text_ = text;
+	Relayout(changedIndex);
+}
+
+void TextLayout::AppendText(const std::wstring& text)
+{
+	if (text.empty())
+	{
+		return;
+	}
+
+	uint32_t changedIndex = static_cast<uint32_t>(text_.size());
+
+	text_ += text;
+	Relayout(changedIndex);
+}
+
+void TextLayout::Relayout(uint32_t changedIndex)
+{
+	/**  ġ  ۸ ĳ  ٸ    UV  ̹Ƿ ó ٽ ġմϴ. */
+	if (font_ && font_->GetEvictionCount() != evictionCount_)
+	{
+		changedIndex = 0;
+	}
+
+	/** ٲ ڰ Ե  ãϴ. ٲ  ù ܾ ª  ٷ ö  Ƿ   պ ٽ ġմϴ. */
+	uint32_t lineIndex = 0;
+	while (lineIndex + 1 < lines_.size() && lines_[lineIndex + 1].beginIndex <= changedIndex)
+	{
+		lineIndex++;
+	}
+
+	if (lineIndex > 0)
+	{
+		lineIndex--;
+	}
+
+	uint32_t beginIndex = 0;
+	if (lineIndex < lines_.size())
+	{
+		beginIndex = lines_[lineIndex].beginIndex;
+		quads_.resize(lines_[lineIndex].quadIndex);
+		lines_.resize(lineIndex);
+	}
+
+	if (lineIndex == 0)
+	{
+		quads_.clear();
+		lines_.clear();
+		shelves_.clear();
+	}
+
+	size_ = Vec2f(0.0f, 0.0f);
+	if (!font_)
+	{
+		return;
+	}
+
+	while (beginIndex < text_.size())
+	{
+		Line line;
+		line.beginIndex = beginIndex;
+		line.endIndex = BreakLine(beginIndex, line.width);
+
+		EmitLine(line);
+		lines_.push_back(line);
+
+		beginIndex = line.endIndex;
+	}
+
+	for (const auto& line : lines_)
+	{
+		size_.x = GameMath::Max<float>(size_.x, line.width);
+	}
+	size_.y = static_cast<float>(lines_.size()) * font_->GetLineHeight();
+
+	/** ġ  ŵ  ̹ ġ ۸  Ƿ, ġ ģ   մϴ. */
+	evictionCount_ = font_->GetEvictionCount();
+}
+
+void TextLayout::Refresh()
+{
+	if (font_ && !font_->TouchShelves(shelves_, evictionCount_))
+	{
+		Relayout(0);
+	}
+}
+
+uint32_t TextLayout::BreakLine(uint32_t beginIndex, float& outWidth) const
+{
+	float x = 0.0f;
+	float lineWidth = 0.0f;
+
+	uint32_t breakIndex = beginIndex; /**  ٷ   εԴϴ. */
+	float breakWidth = 0.0f; /**  ձ  ʺԴϴ. */
+
+	for (uint32_t index = beginIndex; index < text_.size(); ++index)
+	{
+		int32_t codePoint = static_cast<int32_t>(text_[index]);
+		if (codePoint == L'\n')
+		{
+			outWidth = lineWidth;
+			return index + 1;
+		}
+
+		if (index > beginIndex)
+		{
+			x += font_->GetKerning(static_cast<int32_t>(text_[index - 1]), codePoint);
+		}
+
+		Glyph glyph = font_->GetGlyph(codePoint);
+		if (codePoint == L' ' || codePoint == L'\t')
+		{
+			breakIndex = index + 1;
+			breakWidth = lineWidth;
+		}
+		else
+		{
+			float right = x + glyph.xoff + static_cast<float>(glyph.pos1.x - glyph.pos0.x);
+			if (boxWidth_ > 0.0f && right > boxWidth_ && index > beginIndex)
+			{
+				if (breakIndex > beginIndex)
+				{
+					outWidth = breakWidth;
+					return breakIndex;
+				}
+
+				outWidth = lineWidth; /** ں  ܾ   ϴ. */
+				return index;
+			}
+
+			lineWidth = GameMath::Max<float>(lineWidth, right);
+		}
+
+		x += glyph.xadvance;
+	}
+
+	outWidth = lineWidth;
+	return static_cast<uint32_t>(text_.size());
+}
+
+void TextLayout::EmitLine(Line& line)
+{
+	line.quadIndex = static_cast<uint32_t>(quads_.size());
+
+	float x = 0.0f;
+	if (boxWidth_ > 0.0f)
+	{
+		switch (align_)
+		{
+		case Align::CENTER:
+			x = (boxWidth_ - line.width) * 0.5f;
+			break;
+
+		case Align::RIGHT:
+			x = boxWidth_ - line.width;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	float baseline = -static_cast<float>(lines_.size()) * font_->GetLineHeight() - font_->GetAscent();
+	float atlasWidth = static_cast<float>(font_->GetAtlasWidth());
+	float atlasHeight = static_cast<float>(font_->GetAtlasHeight());
+
+	for (uint32_t index = line.beginIndex; index < line.endIndex; ++index)
+	{
+		int32_t codePoint = static_cast<int32_t>(text_[index]);
+		if (codePoint == L'\n')
+		{
+			continue;
+		}
+
+		if (index > line.beginIndex)
+		{
+			x += font_->GetKerning(static_cast<int32_t>(text_[index - 1]), codePoint);
+		}
+
+		uint32_t shelf = 0;
+		Glyph glyph = font_->GetGlyph(codePoint, shelf);
+
+		if (glyph.pos1.x > glyph.pos0.x && glyph.pos1.y > glyph.pos0.y) /** ó ׸   ۸ 簢  ʽϴ. */
+		{
+			GlyphQuad quad;
+			quad.pos0 = Vec2f(x + glyph.xoff, baseline - glyph.yoff);
+			quad.pos1 = Vec2f(quad.pos0.x + static_cast<float>(glyph.pos1.x - glyph.pos0.x), quad.pos0.y - static_cast<float>(glyph.pos1.y - glyph.pos0.y));
+			quad.uv0 = Vec2f(static_cast<float>(glyph.pos0.x) / atlasWidth, static_cast<float>(glyph.pos0.y) / atlasHeight);
+			quad.uv1 = Vec2f(static_cast<float>(glyph.pos1.x) / atlasWidth, static_cast<float>(glyph.pos1.y) / atlasHeight);
+			quads_.push_back(quad);
+		}
+
+		if (font_->IsDynamic() && std::find(shelves_.begin(), shelves_.end(), shelf) == shelves_.end())
+		{
+			shelves_.push_back(shelf);
+		}
+
+		x += glyph.xadvance;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include <algorithm>
+
+#include "Assertion.h"
+#include "NameID.h"
+#include "TextRun.h"
+#include "TTFont.h"
+
+TextRun::TextRun(TTFont* font, const std::wstring& text)
+{
+	Set(font, text);
+}
+
+void TextRun::Set(TTFont* font, const std::wstring& text)
+{
+	uint64_t hash = ComputeHash(font, text);
+	if (font_ == font && hash_ == hash && text_ == text)
+	{
+		return;
+	}
+
+	font_ = font;
+	text_ = text;
+	hash_ = hash;
+
+	Build();
+}
+
+uint64_t TextRun::ComputeHash(const TTFont* font, const std::wstring& text)
+{
+	/** Ʈ ּҿ ؽƮ Ʈ ̾ NameID  FNV-1a ؽմϴ. */
+	uint64_t hash = NameID::Hash(reinterpret_cast<const char*>(&font), sizeof(font));
+	return NameID::Hash(reinterpret_cast<const char*>(text.data()), text.size() * sizeof(wchar_t), hash);
+}
+
+void TextRun::Refresh()
+{
+	if (font_ && !font_->TouchShelves(shelves_, evictionCount_))
+	{
+		Build();
+	}
+}
+
+void TextRun::Build()
+{
+	quads_.clear();
+	shelves_.clear();
+	size_ = Vec2f(0.0f, 0.0f);
+
+	if (!font_)
+	{
+		return;
+	}
+
+	font_->MeasureText(text_, size_.x, size_.y);
+
+	float atlasWidth = static_cast<float>(font_->GetAtlasWidth());
+	float atlasHeight = static_cast<float>(font_->GetAtlasHeight());
+	float x = 0.0f;
+
+	quads_.reserve(text_.size());
+	for (const auto& unicode : text_)
+	{
+		uint32_t shelf = 0;
+		Glyph glyph = font_->GetGlyph(static_cast<int32_t>(unicode), shelf);
+
+		GlyphQuad quad;
+		quad.pos0 = Vec2f(x + glyph.xoff, -size_.y - glyph.yoff);
+		quad.pos1 = Vec2f(quad.pos0.x + static_cast<float>(glyph.pos1.x - glyph.pos0.x), quad.pos0.y - static_cast<float>(glyph.pos1.y - glyph.pos0.y));
+		quad.uv0 = Vec2f(static_cast<float>(glyph.pos0.x) / atlasWidth, static_cast<float>(glyph.pos0.y) / atlasHeight);
+		quad.uv1 = Vec2f(static_cast<float>(glyph.pos1.x) / atlasWidth, static_cast<float>(glyph.pos1.y) / atlasHeight);
+		quads_.push_back(quad);
+
+		if (font_->IsDynamic() && std::find(shelves_.begin(), shelves_.end(), shelf) == shelves_.end())
+		{
+			shelves_.push_back(shelf);
+		}
+
+		x += glyph.xadvance;
+	}
+
+	/** ġ  ŵ  ̹ ġ ۸  Ƿ, ġ ģ   մϴ. */
+	evictionCount_ = font_->GetEvictionCount();
+}
\ No newline at end of file
@@ -5,7 +5,8 @@
 TextUI::TextUI(const Layout& layout)
 	: layout_(layout)
 {
-	layout_.font->MeasureText(layout_.text, textSize_.x, textSize_.y);
+	textRun_.Set(layout_.font, layout_.text);
+	textSize_ = textRun_.GetSize();
 	textPos_ = layout_.textCenterPos + Vec2f(-textSize_.x * 0.5f, +textSize_.y * 0.5f);
 
 	bIsInitialized_ = true;
@@ -34,6 +35,7 @@ void TextUI::SetText(const std::wstring& text)
 {
 	layout_.text = text;
 
-	layout_.font->MeasureText(layout_.text, textSize_.x, textSize_.y);
+	textRun_.Set(layout_.font, layout_.text);
+	textSize_ = textRun_.GetSize();
 	textPos_ = layout_.textCenterPos + Vec2f(-textSize_.x * 0.5f, +textSize_.y * 0.5f);
 }
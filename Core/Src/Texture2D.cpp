@@ -8,58 +8,21 @@
 
 #include "Assertion.h"
 #include "GameUtils.h"
+#include "MappedFile.h"
 #include "RenderStateManager.h"
 #include "Texture2D.h"
+#include "TextureFile.h"
 
 #define PIXEL_FORMAT_R    1
 #define PIXEL_FORMAT_RG   2
 #define PIXEL_FORMAT_RGB  3
 #define PIXEL_FORMAT_RGBA 4
 
-/** https://www.oldunreal.com/editing/s3tc/ARB_texture_compression.pdf */
-#define FOURCC_DXT1 0x31545844
-#define FOURCC_DXT3 0x33545844
-#define FOURCC_DXT5 0x35545844
-
-/** https://learn.microsoft.com/en-us/windows/win32/direct3ddds/dds-header */
-struct DDSHeader 
-{
-	uint8_t  magic[4];
-	uint32_t dwSize;
-	uint32_t dwFlags;
-	uint32_t dwHeight;
-	uint32_t dwWidth;
-	uint32_t dwPitchOrLinearSize;
-	uint32_t dwDepth;
-	uint32_t dwMipMapCount;
-	uint32_t dwReserved1[11];
-
-	/** DDS_PIXEL_FORMAT . */
-	uint32_t dwPixelSize;
-	uint32_t dwPixelFlags;
-	uint32_t dwFourCC;
-	uint32_t dwRGBBitCount;
-	uint32_t dwRBitMask;
-	uint32_t dwGBitMask;
-	uint32_t dwBBitMask;
-	uint32_t dwABitMask;
-	/** DDS_PIXEL_FORMAT . */
-
-	uint32_t dwCaps;
-	uint32_t dwCaps2;
-	uint32_t dwCaps3;
-	uint32_t dwCaps4;
-	uint32_t dwReserved2;
-};
-
 Texture2D::Texture2D(const std::string& path, const Filter& filter)
 {
-	uint32_t format = 0xFFFF;
-	std::vector<uint8_t> buffer;
-	std::string extension = GameUtils::GetFileExtension(path);
-	if (extension == "dds") /** S3TC(DXTn)  ̶. */
+	if (TextureFile::IsTextureFilePath(path)) /** DDS/KTX2 ̳ʶ. (BCn   ) */
 	{
-		textureID_ = CreateTextureFromDDS(path, filter);
+		textureID_ = CreateTextureFromTextureFile(path, filter);
 	}
 	else /**   (PNG, JPG, BMP, TGA ...) */
 	{
@@ -69,6 +32,16 @@ Texture2D::Texture2D(const std::string& path, const Filter& filter)
 	bIsInitialized_ = true;
 }
 
+Texture2D::Texture2D(int32_t width, int32_t height, int32_t channels, const uint8_t* pixels, const Filter& filter)
+	: width_(width)
+	, height_(height)
+	, channels_(channels)
+{
+	textureID_ = CreateTextureFromPixels(pixels, filter);
+
+	bIsInitialized_ = true;
+}
+
 Texture2D::~Texture2D()
 {
 	if (bIsInitialized_)
@@ -92,18 +65,35 @@ void Texture2D::Active(uint32_t unit) const
 	GL_CHECK(glBindTexture(GL_TEXTURE_2D, textureID_));
 }
 
+void Texture2D::CreateTextureFromPixelBuffer(int32_t width, int32_t height, int32_t channels, const Filter& filter)
+{
+	CHECK(!bIsInitialized_);
+
+	width_ = width;
+	height_ = height;
+	channels_ = channels;
+
+	/** ȼ  ۰ εǾ Ƿ nullptr  0  ǹմϴ. */
+	textureID_ = CreateTextureFromPixels(nullptr, filter);
+
+	bIsInitialized_ = true;
+}
+
 uint32_t Texture2D::CreateTextureFromImage(const std::string& path, const Filter& filter)
 {
 	uint8_t* imagePtr = stbi_load(path.c_str(), &width_, &height_, &channels_, 0);
 	ASSERT(imagePtr != nullptr, "failed to load %s file", path.c_str());
-	
-	std::size_t bufferSize = static_cast<std::size_t>(width_ * height_ * channels_);
-	std::vector<uint8_t> buffer(bufferSize);
-	std::copy(imagePtr, imagePtr + bufferSize, buffer.data());
+
+	uint32_t textureID = CreateTextureFromPixels(imagePtr, filter);
 
 	stbi_image_free(imagePtr);
 	imagePtr = nullptr;
 
+	return textureID;
+}
+
+uint32_t Texture2D::CreateTextureFromPixels(const uint8_t* pixels, const Filter& filter)
+{
 	static std::map<uint32_t, uint32_t> formats =
 	{
 		{ PIXEL_FORMAT_R,    GL_RED  },
@@ -113,7 +103,7 @@ uint32_t Texture2D::CreateTextureFromImage(const std::string& path, const Filter
 	};
 
 	GLenum format = formats.at(channels_);
-	const void* bufferPtr = reinterpret_cast<const void*>(buffer.data());
+	const void* bufferPtr = reinterpret_cast<const void*>(pixels);
 	uint32_t textureID = 0;
 
 	GL_CHECK(glGenTextures(1, &textureID));
@@ -129,51 +119,29 @@ uint32_t Texture2D::CreateTextureFromImage(const std::string& path, const Filter
 	return textureID;
 }
 
-uint32_t Texture2D::CreateTextureFromDDS(const std::string& path, const Filter& filter)
+uint32_t Texture2D::CreateTextureFromTextureFile(const std::string& path, const Filter& filter)
 {
-	bool bHasExt = RenderStateManager::GetRef().HasGLExtension("GL_EXT_texture_compression_s3tc");
-	ASSERT(bHasExt, "This hardware does not support 'GL_EXT_texture_compression_s3tc'.");
-
-	std::vector<uint8_t> buffer = GameUtils::ReadFile(path);
-	DDSHeader* ddsFilePtr = reinterpret_cast<DDSHeader*>(buffer.data());
-
-	std::string ddsFileCode;
-	ddsFileCode += ddsFilePtr->magic[0];
-	ddsFileCode += ddsFilePtr->magic[1];
-	ddsFileCode += ddsFilePtr->magic[2];
-	ddsFileCode += ddsFilePtr->magic[3];
-	ASSERT(ddsFileCode == "DDS ", "Invalid %s DDS file code", path.c_str());
-
-	width_ = ddsFilePtr->dwWidth;
-	height_ = ddsFilePtr->dwHeight;
-	channels_ = ddsFilePtr->dwPixelSize / 4;
-	uint32_t linearSize = ddsFilePtr->dwPitchOrLinearSize;
-	uint32_t mipMapCount = ddsFilePtr->dwMipMapCount;
-	uint32_t bufferSize = mipMapCount > 1 ? linearSize * 2 : linearSize;
-	uint8_t* bufferPtr = reinterpret_cast<uint8_t*>(&ddsFilePtr[1]);
-
-	uint32_t format = GL_RGBA;
-	uint32_t blockSize = 0;
-	switch (ddsFilePtr->dwFourCC)
+	MappedFile file(path);
+
+	TextureFile::Desc desc;
+	std::string message;
+	bool bSucceed = TextureFile::Parse(path, file.GetData(), file.GetSize(), desc, message);
+	ASSERT(bSucceed, "Failed to load '%s' file. %s", path.c_str(), message.c_str());
+
+	if (desc.format.extension)
+	{
+		bool bHasExt = RenderStateManager::GetRef().HasGLExtension(desc.format.extension);
+		ASSERT(bHasExt, "This hardware does not support '%s'.", desc.format.extension);
+	}
+
+	width_ = static_cast<int32_t>(desc.width);
+	height_ = static_cast<int32_t>(desc.height);
+	channels_ = static_cast<int32_t>(desc.format.channels);
+
+	GLint minFilter = static_cast<GLint>(filter);
+	if (desc.levelCount > 1 || desc.bGenerateMipmap)
 	{
-	case FOURCC_DXT1:
-		blockSize = 8;
-		format = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
-		break;
-
-	case FOURCC_DXT3:
-		blockSize = 16;
-		format = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
-		break;
-
-	case FOURCC_DXT5:
-		blockSize = 16;
-		format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
-		break;
-
-	default:
-		blockSize = 4;
-		format = GL_RGBA;
+		minFilter = (filter == Filter::NEAREST) ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
 	}
 
 	uint32_t textureID;
@@ -182,36 +150,37 @@ uint32_t Texture2D::CreateTextureFromDDS(const std::string& path, const Filter&
 	GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
 	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
 	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
-	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
-	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(filter)));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0));
 
-	int32_t width = width_;
-	int32_t height = height_;
-	for (uint32_t level = 0, offset = 0; level <= mipMapCount; ++level)
+	if (!desc.bGenerateMipmap)
 	{
-		if (width == 0 || height == 0)
-		{
-			mipMapCount--;
-			continue;
-		}
+		GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(desc.levelCount - 1)));
+	}
 
-		uint32_t size = 0;
-		if (!ddsFilePtr->dwFourCC) /**   X */
+	/**   ε   ŰǷ ߰   ̹ ޵˴ϴ. */
+	for (uint32_t level = 0; level < desc.levelCount; ++level)
+	{
+		const TextureFile::Level& mip = desc.levels[level];
+		const void* pixels = reinterpret_cast<const void*>(file.GetData() + mip.offset);
+
+		if (desc.format.bIsCompressed)
 		{
-			size = width * height * blockSize;
-			GL_CHECK(glTexImage2D(GL_TEXTURE_2D, level, format, width, height, 0, format, GL_UNSIGNED_BYTE, bufferPtr + offset));
+			GL_CHECK(glCompressedTexImage2D(GL_TEXTURE_2D, level, desc.format.internalFormat, mip.width, mip.height, 0, static_cast<GLsizei>(mip.size), pixels));
 		}
 		else
 		{
-			size = ((width + 3) / 4) * ((height + 3) / 4) * blockSize;
-			GL_CHECK(glCompressedTexImage2D(GL_TEXTURE_2D, level, format, width, height, 0, size, bufferPtr + offset));
+			GL_CHECK(glTexImage2D(GL_TEXTURE_2D, level, desc.format.internalFormat, mip.width, mip.height, 0, desc.format.format, desc.format.type, pixels));
 		}
+	}
 
-		offset += size;
-		width /= 2;
-		height /= 2;
+	if (desc.bGenerateMipmap)
+	{
+		GL_CHECK(glGenerateMipmap(GL_TEXTURE_2D));
 	}
 
+	GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
 	GL_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
 
 	return textureID;
@@ -0,0 +1,126 @@
+#pragma warning(push)
+#pragma warning(disable: 26451)
+
+#include <glad/glad.h>
+#include <stb_image.h>
+
+#include "Assertion.h"
+#include "Texture2D.h"
+#include "TextureArray2D.h"
+
+TextureArray2D::TextureArray2D(int32_t width, int32_t height, int32_t maxLayerCount, const Filter& filter)
+	: width_(width)
+	, height_(height)
+	, maxLayerCount_(maxLayerCount)
+{
+	GLint maxArrayLayers = 0;
+	GL_CHECK(glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxArrayLayers));
+	ASSERT(0 < maxLayerCount_ && maxLayerCount_ <= maxArrayLayers, "Invalid texture array layer count %d (max: %d).", maxLayerCount_, maxArrayLayers);
+
+	layerSizes_.resize(maxLayerCount_, Vec2i(0, 0));
+	freeLayers_.reserve(maxLayerCount_);
+	for (int32_t layer = maxLayerCount_ - 1; layer >= 0; --layer)
+	{
+		freeLayers_.push_back(layer);
+	}
+
+	GL_CHECK(glGenTextures(1, &textureID_));
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D_ARRAY, textureID_));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(filter)));
+	GL_CHECK(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(filter)));
+	GL_CHECK(glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, width_, height_, maxLayerCount_));
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D_ARRAY, 0));
+
+	bIsInitialized_ = true;
+}
+
+TextureArray2D::~TextureArray2D()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void TextureArray2D::Release()
+{
+	CHECK(bIsInitialized_);
+
+	GL_CHECK(glDeleteTextures(1, &textureID_));
+
+	layerSizes_.clear();
+	freeLayers_.clear();
+
+	bIsInitialized_ = false;
+}
+
+void TextureArray2D::Active(uint32_t unit) const
+{
+	GL_CHECK(glActiveTexture(GL_TEXTURE0 + unit));
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D_ARRAY, textureID_));
+}
+
+int32_t TextureArray2D::AddLayer(const std::string& path)
+{
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+	uint8_t* imagePtr = stbi_load(path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+	ASSERT(imagePtr != nullptr, "failed to load %s file", path.c_str());
+
+	int32_t layer = AllocateLayer(width, height);
+
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D_ARRAY, textureID_));
+	GL_CHECK(glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, imagePtr));
+	GL_CHECK(glBindTexture(GL_TEXTURE_2D_ARRAY, 0));
+
+	stbi_image_free(imagePtr);
+	imagePtr = nullptr;
+
+	return layer;
+}
+
+int32_t TextureArray2D::Register(const Texture2D* texture)
+{
+	CHECK(texture != nullptr);
+	ASSERT(texture->GetChannels() == 4, "Only RGBA textures can be registered to texture array.");
+
+	int32_t width = texture->GetWidth();
+	int32_t height = texture->GetHeight();
+	int32_t layer = AllocateLayer(width, height);
+
+	GL_CHECK(glCopyImageSubData(texture->textureID_, GL_TEXTURE_2D, 0, 0, 0, 0, textureID_, GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, width, height, 1));
+
+	return layer;
+}
+
+void TextureArray2D::RemoveLayer(int32_t layer)
+{
+	CHECK(0 <= layer && layer < maxLayerCount_);
+	CHECK(layerSizes_[layer].x > 0 && layerSizes_[layer].y > 0);
+
+	layerSizes_[layer] = Vec2i(0, 0);
+	freeLayers_.push_back(layer);
+}
+
+const Vec2i& TextureArray2D::GetLayerSize(int32_t layer) const
+{
+	CHECK(0 <= layer && layer < maxLayerCount_);
+	return layerSizes_[layer];
+}
+
+int32_t TextureArray2D::AllocateLayer(int32_t width, int32_t height)
+{
+	ASSERT(width <= width_ && height <= height_, "Image size (%d x %d) exceeds texture array layer size (%d x %d).", width, height, width_, height_);
+	ASSERT(!freeLayers_.empty(), "Texture array has no free layer.");
+
+	int32_t layer = freeLayers_.back();
+	freeLayers_.pop_back();
+
+	layerSizes_[layer] = Vec2i(width, height);
+	return layer;
+}
+
+#pragma warning(pop)
\ No newline at end of file
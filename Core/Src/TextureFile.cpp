@@ -0,0 +1,406 @@
+#include <algorithm>
+#include <cstring>
+
+#include <glad/glad.h>
+
+#include "GameUtils.h"
+#include "TextureFile.h"
+
+/** https://registry.khronos.org/OpenGL/extensions/EXT/EXT_texture_sRGB.txt */
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT       0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT 0x8C4E
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+/** https://learn.microsoft.com/en-us/windows/win32/direct3ddds/dds-header */
+#define DDS_MAGIC             0x20534444
+#define DDSD_MIPMAPCOUNT      0x00020000
+#define DDPF_FOURCC           0x00000004
+#define DDPF_RGB              0x00000040
+#define DDSCAPS2_CUBEMAP      0x00000200
+#define DDSCAPS2_VOLUME       0x00200000
+#define DDS_DIMENSION_TEXTURE2D 3
+
+/** https://www.oldunreal.com/editing/s3tc/ARB_texture_compression.pdf */
+#define FOURCC_DXT1 0x31545844
+#define FOURCC_DXT3 0x33545844
+#define FOURCC_DXT5 0x35545844
+#define FOURCC_ATI1 0x31495441
+#define FOURCC_BC4U 0x55344342
+#define FOURCC_BC4S 0x53344342
+#define FOURCC_ATI2 0x32495441
+#define FOURCC_BC5U 0x55354342
+#define FOURCC_BC5S 0x53354342
+#define FOURCC_DX10 0x30315844
+
+static const char* EXT_S3TC = "GL_EXT_texture_compression_s3tc";
+
+struct DDSHeader 
+{
+	uint32_t dwMagic;
+	uint32_t dwSize;
+	uint32_t dwFlags;
+	uint32_t dwHeight;
+	uint32_t dwWidth;
+	uint32_t dwPitchOrLinearSize;
+	uint32_t dwDepth;
+	uint32_t dwMipMapCount;
+	uint32_t dwReserved1[11];
+
+	/** DDS_PIXEL_FORMAT . */
+	uint32_t dwPixelSize;
+	uint32_t dwPixelFlags;
+	uint32_t dwFourCC;
+	uint32_t dwRGBBitCount;
+	uint32_t dwRBitMask;
+	uint32_t dwGBitMask;
+	uint32_t dwBBitMask;
+	uint32_t dwABitMask;
+	/** DDS_PIXEL_FORMAT . */
+
+	uint32_t dwCaps;
+	uint32_t dwCaps2;
+	uint32_t dwCaps3;
+	uint32_t dwCaps4;
+	uint32_t dwReserved2;
+};
+
+/** https://learn.microsoft.com/en-us/windows/win32/direct3ddds/dds-header-dxt10 */
+struct DDSHeaderDX10
+{
+	uint32_t dxgiFormat;
+	uint32_t resourceDimension;
+	uint32_t miscFlag;
+	uint32_t arraySize;
+	uint32_t miscFlags2;
+};
+
+/** https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html */
+struct KTX2Header
+{
+	uint8_t identifier[12];
+	uint32_t vkFormat;
+	uint32_t typeSize;
+	uint32_t pixelWidth;
+	uint32_t pixelHeight;
+	uint32_t pixelDepth;
+	uint32_t layerCount;
+	uint32_t faceCount;
+	uint32_t levelCount;
+	uint32_t supercompressionScheme;
+	uint32_t dfdByteOffset;
+	uint32_t dfdByteLength;
+	uint32_t kvdByteOffset;
+	uint32_t kvdByteLength;
+	uint64_t sgdByteOffset;
+	uint64_t sgdByteLength;
+};
+
+struct KTX2LevelIndex
+{
+	uint64_t byteOffset;
+	uint64_t byteLength;
+	uint64_t uncompressedByteLength;
+};
+
+static const uint8_t KTX2_IDENTIFIER[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+static_assert(sizeof(DDSHeader) == 128, "DDS header must be 128 bytes including the magic.");
+static_assert(sizeof(KTX2Header) == 80, "KTX2 header must be 80 bytes.");
+
+/** DXGI_FORMAT VkFormat  GL  ŵϴ. ϴ   0Դϴ. */
+struct FormatEntry
+{
+	uint32_t dxgiFormat;
+	uint32_t vkFormat;
+	TextureFile::Format format;
+};
+
+static const FormatEntry FORMAT_ENTRIES[] =
+{
+	{ 28,  37, { GL_RGBA8,                                  GL_RGBA, GL_UNSIGNED_BYTE, 4,  4, false, nullptr  }, },
+	{ 29,  43, { GL_SRGB8_ALPHA8,                           GL_RGBA, GL_UNSIGNED_BYTE, 4,  4, false, nullptr  }, },
+	{ 87,   0, { GL_RGBA8,                                  GL_BGRA, GL_UNSIGNED_BYTE, 4,  4, false, nullptr  }, },
+	{ 91,   0, { GL_SRGB8_ALPHA8,                           GL_BGRA, GL_UNSIGNED_BYTE, 4,  4, false, nullptr  }, },
+	{  0,  23, { GL_RGB8,                                   GL_RGB,  GL_UNSIGNED_BYTE, 3,  3, false, nullptr  }, },
+	{  0,  29, { GL_SRGB8,                                  GL_RGB,  GL_UNSIGNED_BYTE, 3,  3, false, nullptr  }, },
+	{  0, 131, { GL_COMPRESSED_RGB_S3TC_DXT1_EXT,           0,       0,                3,  8, true,  EXT_S3TC }, },
+	{  0, 132, { GL_COMPRESSED_SRGB_S3TC_DXT1_EXT,          0,       0,                3,  8, true,  EXT_S3TC }, },
+	{ 71, 133, { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,          0,       0,                4,  8, true,  EXT_S3TC }, },
+	{ 72, 134, { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,    0,       0,                4,  8, true,  EXT_S3TC }, },
+	{ 74, 135, { GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,          0,       0,                4, 16, true,  EXT_S3TC }, },
+	{ 75, 136, { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT,    0,       0,                4, 16, true,  EXT_S3TC }, },
+	{ 77, 137, { GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,          0,       0,                4, 16, true,  EXT_S3TC }, },
+	{ 78, 138, { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,    0,       0,                4, 16, true,  EXT_S3TC }, },
+	{ 80, 139, { GL_COMPRESSED_RED_RGTC1,                   0,       0,                1,  8, true,  nullptr  }, },
+	{ 81, 140, { GL_COMPRESSED_SIGNED_RED_RGTC1,            0,       0,                1,  8, true,  nullptr  }, },
+	{ 83, 141, { GL_COMPRESSED_RG_RGTC2,                    0,       0,                2, 16, true,  nullptr  }, },
+	{ 84, 142, { GL_COMPRESSED_SIGNED_RG_RGTC2,             0,       0,                2, 16, true,  nullptr  }, },
+	{ 95, 143, { GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT,     0,       0,                3, 16, true,  nullptr  }, },
+	{ 96, 144, { GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT,       0,       0,                3, 16, true,  nullptr  }, },
+	{ 98, 145, { GL_COMPRESSED_RGBA_BPTC_UNORM,             0,       0,                4, 16, true,  nullptr  }, },
+	{ 99, 146, { GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,       0,       0,                4, 16, true,  nullptr  }, },
+};
+
+static bool FindFormat(uint32_t FormatEntry::* key, uint32_t value, TextureFile::Format& outFormat)
+{
+	if (value == 0)
+	{
+		return false;
+	}
+
+	for (const auto& entry : FORMAT_ENTRIES)
+	{
+		if (entry.*key == value)
+		{
+			outFormat = entry.format;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool GetDDSFormat(const DDSHeader* header, const DDSHeaderDX10* headerDX10, TextureFile::Format& outFormat)
+{
+	if (headerDX10)
+	{
+		return FindFormat(&FormatEntry::dxgiFormat, headerDX10->dxgiFormat, outFormat);
+	}
+
+	if (header->dwPixelFlags & DDPF_FOURCC)
+	{
+		switch (header->dwFourCC)
+		{
+		case FOURCC_DXT1: return FindFormat(&FormatEntry::dxgiFormat, 71, outFormat);
+		case FOURCC_DXT3: return FindFormat(&FormatEntry::dxgiFormat, 74, outFormat);
+		case FOURCC_DXT5: return FindFormat(&FormatEntry::dxgiFormat, 77, outFormat);
+		case FOURCC_ATI1:
+		case FOURCC_BC4U: return FindFormat(&FormatEntry::dxgiFormat, 80, outFormat);
+		case FOURCC_BC4S: return FindFormat(&FormatEntry::dxgiFormat, 81, outFormat);
+		case FOURCC_ATI2:
+		case FOURCC_BC5U: return FindFormat(&FormatEntry::dxgiFormat, 83, outFormat);
+		case FOURCC_BC5S: return FindFormat(&FormatEntry::dxgiFormat, 84, outFormat);
+		default: return false;
+		}
+	}
+
+	if (header->dwPixelFlags & DDPF_RGB)
+	{
+		bool bIsBGR = (header->dwRBitMask == 0x00FF0000);
+		if (header->dwRGBBitCount == 32)
+		{
+			return FindFormat(&FormatEntry::dxgiFormat, bIsBGR ? 87 : 28, outFormat);
+		}
+
+		if (header->dwRGBBitCount == 24)
+		{
+			bool bSucceed = FindFormat(&FormatEntry::vkFormat, 23, outFormat);
+			outFormat.format = bIsBGR ? GL_BGR : GL_RGB;
+			return bSucceed;
+		}
+	}
+
+	return false;
+}
+
+bool TextureFile::IsTextureFilePath(const std::string& path)
+{
+	std::string extension = GameUtils::ToLower(GameUtils::GetFileExtension(path));
+	return extension == "dds" || extension == "ktx2";
+}
+
+bool TextureFile::Parse(const std::string& path, const uint8_t* data, std::size_t size, Desc& outDesc, std::string& outResult)
+{
+	std::string extension = GameUtils::ToLower(GameUtils::GetFileExtension(path));
+	if (extension == "dds")
+	{
+		return ParseDDS(data, size, outDesc, outResult);
+	}
+
+	if (extension == "ktx2")
+	{
+		return ParseKTX2(data, size, outDesc, outResult);
+	}
+
+	outResult = GameUtils::PrintF("Unsupported '%s' texture file.", path.c_str());
+	return false;
+}
+
+bool TextureFile::ParseDDS(const uint8_t* data, std::size_t size, Desc& outDesc, std::string& outResult)
+{
+	if (size < sizeof(DDSHeader))
+	{
+		outResult = "DDS file is smaller than its header.";
+		return false;
+	}
+
+	const DDSHeader* header = reinterpret_cast<const DDSHeader*>(data);
+	if (header->dwMagic != DDS_MAGIC || header->dwSize != sizeof(DDSHeader) - sizeof(uint32_t))
+	{
+		outResult = "Invalid DDS file code.";
+		return false;
+	}
+
+	if (header->dwCaps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME))
+	{
+		outResult = "Cube map and volume DDS files are not supported.";
+		return false;
+	}
+
+	std::size_t dataOffset = sizeof(DDSHeader);
+	const DDSHeaderDX10* headerDX10 = nullptr;
+	if ((header->dwPixelFlags & DDPF_FOURCC) && header->dwFourCC == FOURCC_DX10)
+	{
+		if (size < dataOffset + sizeof(DDSHeaderDX10))
+		{
+			outResult = "DDS file is smaller than its DX10 header.";
+			return false;
+		}
+
+		headerDX10 = reinterpret_cast<const DDSHeaderDX10*>(data + dataOffset);
+		dataOffset += sizeof(DDSHeaderDX10);
+
+		if (headerDX10->resourceDimension != DDS_DIMENSION_TEXTURE2D || headerDX10->arraySize > 1)
+		{
+			outResult = "Only single 2D DX10 DDS textures are supported.";
+			return false;
+		}
+	}
+
+	if (!GetDDSFormat(header, headerDX10, outDesc.format))
+	{
+		outResult = GameUtils::PrintF("Unsupported DDS pixel format (fourCC: 0x%08X, dxgi: %d).", header->dwFourCC, headerDX10 ? headerDX10->dxgiFormat : 0);
+		return false;
+	}
+
+	outDesc.width = header->dwWidth;
+	outDesc.height = header->dwHeight;
+	outDesc.bGenerateMipmap = false;
+
+	uint32_t levelCount = ((header->dwFlags & DDSD_MIPMAPCOUNT) && header->dwMipMapCount > 0) ? header->dwMipMapCount : 1;
+	outDesc.levelCount = std::min<uint32_t>(levelCount, std::min<uint32_t>(GetFullLevelCount(outDesc.width, outDesc.height), MAX_LEVEL_COUNT));
+
+	std::size_t offset = dataOffset;
+	for (uint32_t level = 0; level < outDesc.levelCount; ++level)
+	{
+		Level& mip = outDesc.levels[level];
+		mip.width = std::max<uint32_t>(1, outDesc.width >> level);
+		mip.height = std::max<uint32_t>(1, outDesc.height >> level);
+		mip.offset = offset;
+		mip.size = GetLevelSize(outDesc.format, mip.width, mip.height);
+
+		if (mip.offset > size || mip.size > size - mip.offset)
+		{
+			outResult = GameUtils::PrintF("DDS mip level %d exceeds file size.", level);
+			return false;
+		}
+
+		offset += mip.size;
+	}
+
+	outResult = "Succeed to parse DDS file.";
+	return true;
+}
+
+bool TextureFile::ParseKTX2(const uint8_t* data, std::size_t size, Desc& outDesc, std::string& outResult)
+{
+	if (size < sizeof(KTX2Header))
+	{
+		outResult = "KTX2 file is smaller than its header.";
+		return false;
+	}
+
+	const KTX2Header* header = reinterpret_cast<const KTX2Header*>(data);
+	if (std::memcmp(header->identifier, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) != 0)
+	{
+		outResult = "Invalid KTX2 file identifier.";
+		return false;
+	}
+
+	if (header->pixelDepth != 0 || header->layerCount > 1 || header->faceCount != 1)
+	{
+		outResult = "Only single 2D KTX2 textures are supported.";
+		return false;
+	}
+
+	if (header->supercompressionScheme != 0)
+	{
+		outResult = GameUtils::PrintF("Unsupported KTX2 supercompression scheme %d.", header->supercompressionScheme);
+		return false;
+	}
+
+	if (!FindFormat(&FormatEntry::vkFormat, header->vkFormat, outDesc.format))
+	{
+		outResult = GameUtils::PrintF("Unsupported KTX2 vkFormat %d.", header->vkFormat);
+		return false;
+	}
+
+	outDesc.width = header->pixelWidth;
+	outDesc.height = header->pixelHeight;
+	outDesc.levelCount = std::max<uint32_t>(1, header->levelCount);
+	outDesc.bGenerateMipmap = (header->levelCount == 0) && !outDesc.format.bIsCompressed;
+
+	if (outDesc.levelCount > std::min<uint32_t>(GetFullLevelCount(outDesc.width, outDesc.height), MAX_LEVEL_COUNT))
+	{
+		outResult = GameUtils::PrintF("Invalid KTX2 level count %d.", outDesc.levelCount);
+		return false;
+	}
+
+	std::size_t levelIndexOffset = sizeof(KTX2Header);
+	if (size < levelIndexOffset + outDesc.levelCount * sizeof(KTX2LevelIndex))
+	{
+		outResult = "KTX2 file is smaller than its level index.";
+		return false;
+	}
+
+	const KTX2LevelIndex* levelIndices = reinterpret_cast<const KTX2LevelIndex*>(data + levelIndexOffset);
+	for (uint32_t level = 0; level < outDesc.levelCount; ++level)
+	{
+		Level& mip = outDesc.levels[level];
+		mip.width = std::max<uint32_t>(1, outDesc.width >> level);
+		mip.height = std::max<uint32_t>(1, outDesc.height >> level);
+		mip.size = GetLevelSize(outDesc.format, mip.width, mip.height);
+
+		/**  byteOffset  64Ʈ ̹Ƿ, ϰų size_t ٲٱ   Ȯմϴ. */
+		uint64_t byteOffset = levelIndices[level].byteOffset;
+		if (levelIndices[level].byteLength < mip.size || byteOffset > size || mip.size > size - byteOffset)
+		{
+			outResult = GameUtils::PrintF("KTX2 mip level %d is out of range.", level);
+			return false;
+		}
+
+		mip.offset = static_cast<std::size_t>(byteOffset);
+	}
+
+	outResult = "Succeed to parse KTX2 file.";
+	return true;
+}
+
+uint32_t TextureFile::GetFullLevelCount(uint32_t width, uint32_t height)
+{
+	uint32_t size = std::max<uint32_t>(width, height);
+	uint32_t levelCount = 1;
+
+	while (size > 1)
+	{
+		size >>= 1;
+		++levelCount;
+	}
+
+	return levelCount;
+}
+
+std::size_t TextureFile::GetLevelSize(const Format& format, uint32_t width, uint32_t height)
+{
+	if (format.bIsCompressed)
+	{
+		std::size_t blockCountX = std::max<std::size_t>(1, (static_cast<std::size_t>(width) + 3) / 4);
+		std::size_t blockCountY = std::max<std::size_t>(1, (static_cast<std::size_t>(height) + 3) / 4);
+		return blockCountX * blockCountY * format.blockSize;
+	}
+
+	return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * format.blockSize;
+}
\ No newline at end of file
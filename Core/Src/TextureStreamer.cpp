@@ -0,0 +1,282 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include <glad/glad.h>
+
+#include "Assertion.h"
+#include "MappedFile.h"
+#include "StreamTexture2D.h"
+#include "TextureStreamer.h"
+
+TextureStreamer TextureStreamer::instance_;
+
+/** Ŀ 尡 ε Ͽ PBO ϴ   ϳԴϴ. bIsDone     Ŀ ٲ ʽϴ. */
+struct TextureStreamer::LevelLoad
+{
+	StreamTexture2D* texture = nullptr; /**   Դϴ. ε  ıǸ nullptr ˴ϴ. */
+	uint32_t level = 0;
+
+	std::shared_ptr<MappedFile> file = nullptr; /**   ؽó ıǾ  մϴ. */
+	const uint8_t* srcPtr = nullptr;
+	std::size_t byteSize = 0;
+
+	uint32_t pixelBufferID = 0;
+	uint8_t* mappedPtr = nullptr;
+
+	std::atomic<bool> bIsDone = false;
+};
+
+TextureStreamer& TextureStreamer::GetRef()
+{
+	return instance_;
+}
+
+TextureStreamer* TextureStreamer::GetPtr()
+{
+	return &instance_;
+}
+
+void TextureStreamer::Tick()
+{
+	++frame_;
+
+	CompleteLoads();
+	UpdateTargets();
+	Reclaim(0);
+	StartLoads();
+}
+
+void TextureStreamer::Startup()
+{
+	stats_ = Stats();
+	stats_.budgetByteSize = DEFAULT_BUDGET_BYTE_SIZE;
+
+	bIsStopWorker_ = false;
+	worker_ = std::thread([this]() { RunWorker(); });
+}
+
+void TextureStreamer::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(jobMutex_);
+		bIsStopWorker_ = true;
+	}
+	jobCondition_.notify_all();
+
+	if (worker_.joinable())
+	{
+		worker_.join();
+	}
+
+	while (!jobs_.empty())
+	{
+		jobs_.front()->bIsDone.store(true, std::memory_order_release);
+		jobs_.pop();
+	}
+
+	for (auto& load : loads_)
+	{
+		load->texture = nullptr;
+	}
+	CompleteLoads();
+
+	textures_.clear();
+}
+
+void TextureStreamer::Register(StreamTexture2D* texture)
+{
+	textures_.push_back(texture);
+
+	stats_.textureCount = static_cast<uint32_t>(textures_.size());
+	stats_.residentByteSize += texture->GetResidentByteSize();
+}
+
+void TextureStreamer::Unregister(StreamTexture2D* texture)
+{
+	auto it = std::find(textures_.begin(), textures_.end(), texture);
+	if (it == textures_.end())
+	{
+		return;
+	}
+
+	for (auto& load : loads_)
+	{
+		if (load->texture == texture)
+		{
+			load->texture = nullptr;
+		}
+	}
+
+	textures_.erase(it);
+
+	stats_.textureCount = static_cast<uint32_t>(textures_.size());
+	stats_.residentByteSize -= texture->GetResidentByteSize();
+}
+
+void TextureStreamer::CompleteLoads()
+{
+	for (auto it = loads_.begin(); it != loads_.end();)
+	{
+		LevelLoad* load = it->get();
+		if (!load->bIsDone.load(std::memory_order_acquire))
+		{
+			++it;
+			continue;
+		}
+
+		GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, load->pixelBufferID));
+		GL_CHECK(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+
+		if (load->texture)
+		{
+			load->texture->UploadLevel(load->level, nullptr);
+			load->texture->bIsLoading_ = false;
+
+			stats_.residentByteSize += load->byteSize;
+			stats_.loadedLevelCount++;
+		}
+
+		GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+		GL_CHECK(glDeleteBuffers(1, &load->pixelBufferID));
+
+		stats_.pendingByteSize -= load->byteSize;
+		it = loads_.erase(it);
+	}
+
+	stats_.pendingLoadCount = static_cast<uint32_t>(loads_.size());
+}
+
+void TextureStreamer::UpdateTargets()
+{
+	for (auto& texture : textures_)
+	{
+		uint32_t requestedLevel = texture->requestedLevel_.exchange(StreamTexture2D::NOT_REQUESTED, std::memory_order_relaxed);
+		if (requestedLevel != StreamTexture2D::NOT_REQUESTED)
+		{
+			texture->targetLevel_ = requestedLevel;
+			texture->lastRequestFrame_ = frame_;
+		}
+		else
+		{
+			texture->targetLevel_ = texture->pinnedLevel_; /** ׸  ؽó       ϴ. */
+		}
+	}
+}
+
+bool TextureStreamer::Reclaim(std::size_t byteSize)
+{
+	while (stats_.residentByteSize + stats_.pendingByteSize + byteSize > stats_.budgetByteSize)
+	{
+		/** û ū   ؽó    û  ؽó ϴ. */
+		StreamTexture2D* victim = nullptr;
+		for (auto& texture : textures_)
+		{
+			if (texture->bIsLoading_ || texture->residentLevel_ >= texture->targetLevel_ || texture->residentLevel_ >= texture->pinnedLevel_)
+			{
+				continue;
+			}
+
+			if (!victim || texture->lastRequestFrame_ < victim->lastRequestFrame_)
+			{
+				victim = texture;
+			}
+		}
+
+		if (!victim)
+		{
+			return false;
+		}
+
+		std::size_t levelByteSize = victim->desc_.levels[victim->residentLevel_].size;
+		victim->EvictLevel();
+
+		stats_.residentByteSize -= levelByteSize;
+		stats_.evictedLevelCount++;
+	}
+
+	return true;
+}
+
+void TextureStreamer::StartLoads()
+{
+	std::vector<StreamTexture2D*> candidates;
+	for (auto& texture : textures_)
+	{
+		if (!texture->bIsLoading_ && texture->targetLevel_ < texture->residentLevel_)
+		{
+			candidates.push_back(texture);
+		}
+	}
+
+	/** û    ܰ谡  ؽó øϴ. */
+	auto compare = [](const StreamTexture2D* l, const StreamTexture2D* r) { return (l->residentLevel_ - l->targetLevel_) > (r->residentLevel_ - r->targetLevel_); };
+	std::sort(candidates.begin(), candidates.end(), compare);
+
+	for (auto& texture : candidates)
+	{
+		if (loads_.size() >= MAX_PENDING_LOAD_COUNT)
+		{
+			break;
+		}
+
+		uint32_t level = texture->residentLevel_ - 1;
+		const TextureFile::Level& mip = texture->desc_.levels[level];
+		if (!Reclaim(mip.size))
+		{
+			continue;
+		}
+
+		std::shared_ptr<LevelLoad> load = std::make_shared<LevelLoad>();
+		load->texture = texture;
+		load->level = level;
+		load->file = texture->file_;
+		load->srcPtr = texture->file_->GetData() + mip.offset;
+		load->byteSize = mip.size;
+
+		GLsizeiptr byteSize = static_cast<GLsizeiptr>(load->byteSize);
+		GL_CHECK(glGenBuffers(1, &load->pixelBufferID));
+		GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, load->pixelBufferID));
+		GL_CHECK(glBufferData(GL_PIXEL_UNPACK_BUFFER, byteSize, nullptr, GL_STREAM_DRAW));
+		GL_CHECK(load->mappedPtr = reinterpret_cast<uint8_t*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, byteSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT)));
+		GL_CHECK(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+		CHECK(load->mappedPtr != nullptr);
+
+		texture->bIsLoading_ = true;
+		loads_.push_back(load);
+
+		stats_.pendingByteSize += load->byteSize;
+
+		{
+			std::lock_guard<std::mutex> lock(jobMutex_);
+			jobs_.push(load);
+		}
+		jobCondition_.notify_one();
+	}
+
+	stats_.pendingLoadCount = static_cast<uint32_t>(loads_.size());
+}
+
+void TextureStreamer::RunWorker()
+{
+	while (true)
+	{
+		std::shared_ptr<LevelLoad> load = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(jobMutex_);
+			jobCondition_.wait(lock, [this]() { return bIsStopWorker_ || !jobs_.empty(); });
+
+			if (bIsStopWorker_)
+			{
+				return;
+			}
+
+			load = jobs_.front();
+			jobs_.pop();
+		}
+
+		/** ε   Ʈ(ũ б)  翡 ϾǷ  带  ʽϴ. */
+		std::memcpy(load->mappedPtr, load->srcPtr, load->byteSize);
+		load->bIsDone.store(true, std::memory_order_release);
+	}
+}
\ No newline at end of file
@@ -1,3 +1,6 @@
+#include <cstring>
+#include <map>
+
 #include <json/json.h>
 
 #include "Assertion.h"
@@ -5,6 +8,7 @@
 #include "Camera2D.h"
 #include "EntityManager.h"
 #include "GameUtils.h"
+#include "MappedFile.h"
 #include "PanelUI.h"
 #include "RenderManager2D.h"
 #include "TextUI.h"
@@ -99,85 +103,221 @@ bool GetFloatFromJson(const Json::Value& root, const std::string& name, float& o
 	return true;
 }
 
-UIManager& UIManager::GetRef()
+/** UI ̾ƿ ʵ Դϴ. ŷ    float  մϴ. */
+struct LayoutField
 {
-	return instance_;
-}
+	const char* name;
+	uint32_t count; /** 4: , 2: 2 , 1: Ǽ */
+};
 
-UIManager* UIManager::GetPtr()
+static const std::map<std::string, std::vector<LayoutField>> LAYOUT_FIELDS =
 {
-	return &instance_;
+	{ "button", { { "textColor", 4 }, { "disableColor", 4 }, { "enableColor", 4 }, { "pressColor", 4 }, { "releaseColor", 4 }, { "center", 2 }, { "size", 2 }, { "side", 1 }, }, },
+	{ "panel",  { { "backgroundColor", 4 }, { "outlineColor", 4 }, { "textColor", 4 }, { "center", 2 }, { "size", 2 }, { "side", 1 }, }, },
+	{ "text",   { { "textColor", 4 }, { "center", 2 }, }, },
+};
+
+/** ŷ UI ̾ƿ  Դϴ. ̾ float  迭 UTF-8 ؽƮ ɴϴ. */
+static const uint32_t COOKED_LAYOUT_MAGIC = 0x49554D47; /** 'GMUI' */
+static const uint32_t COOKED_LAYOUT_VERSION = 1;
+
+struct CookedLayoutHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	char type[16];
+	uint32_t valueCount;
+	uint32_t textLength;
+};
+
+bool GetFieldFromJson(const Json::Value& root, const LayoutField& field, float* outValue)
+{
+	switch (field.count)
+	{
+	case 4:
+	{
+		Vec4f color;
+		if (!GetColorFromJson(root, field.name, color))
+		{
+			return false;
+		}
+		std::memcpy(outValue, color.data, sizeof(Vec4f));
+	}
+	break;
+
+	case 2:
+	{
+		Vec2f vec2;
+		if (!GetVec2FromJson(root, field.name, vec2))
+		{
+			return false;
+		}
+		std::memcpy(outValue, vec2.data, sizeof(Vec2f));
+	}
+	break;
+
+	case 1:
+		return GetFloatFromJson(root, field.name, *outValue);
+
+	default:
+		return false;
+	}
+
+	return true;
 }
 
-ButtonUI* UIManager::CreateButtonUI(const std::string& path, const Mouse& mouse, TTFont* font, const std::function<void()>& clickEvent)
+/** ΰ ŷ (.cooked)̸ ε 信  ϰ, ƴϸ JSON Ľմϴ. outValues ʵ  ϴ. */
+void LoadLayout(const std::string& path, const std::string& type, float* const* outValues, std::wstring& outText)
 {
+	const std::vector<LayoutField>& fields = LAYOUT_FIELDS.at(type);
+
+	if (GameUtils::ToLower(GameUtils::GetFileExtension(path)) == "cooked")
+	{
+		MappedFile file(path);
+
+		const CookedLayoutHeader* header = file.GetPtr<CookedLayoutHeader>(0);
+		ASSERT(header != nullptr && header->magic == COOKED_LAYOUT_MAGIC, "Invalid cooked layout '%s' file.", path.c_str());
+		ASSERT(header->version == COOKED_LAYOUT_VERSION, "Unsupported cooked layout version %d in '%s' file.", header->version, path.c_str());
+		CHECK(std::strncmp(header->type, type.c_str(), sizeof(header->type)) == 0);
+
+		const float* values = file.GetPtr<float>(sizeof(CookedLayoutHeader), header->valueCount);
+		const char* text = file.GetPtr<char>(sizeof(CookedLayoutHeader) + header->valueCount * sizeof(float), header->textLength);
+		ASSERT(values != nullptr && text != nullptr, "Truncated cooked layout '%s' file.", path.c_str());
+
+		uint32_t offset = 0;
+		for (uint32_t index = 0; index < fields.size(); ++index)
+		{
+			CHECK(offset + fields[index].count <= header->valueCount);
+			std::memcpy(outValues[index], values + offset, fields[index].count * sizeof(float));
+			offset += fields[index].count;
+		}
+
+		outText = GameUtils::Convert(std::string(text, header->textLength));
+		return;
+	}
+
 	Json::Value root;
 	std::string message;
 	bool bSucceed = ReadJsonFile(path, root, message);
 	ASSERT(bSucceed, "%s", message.c_str());
 
-	std::string type;
-	CHECK(GetStringFromJson(root, "type", type) && type == "button");
+	std::string jsonType;
+	CHECK(GetStringFromJson(root, "type", jsonType) && jsonType == type);
+
+	for (uint32_t index = 0; index < fields.size(); ++index)
+	{
+		CHECK(GetFieldFromJson(root, fields[index], outValues[index]));
+	}
 
+	CHECK(GetWStringFromJson(root, "text", outText));
+}
+
+UIManager& UIManager::GetRef()
+{
+	return instance_;
+}
+
+UIManager* UIManager::GetPtr()
+{
+	return &instance_;
+}
+
+ButtonUI* UIManager::CreateButtonUI(const std::string& path, const Mouse& mouse, TTFont* font, const std::function<void()>& clickEvent)
+{
 	ButtonUI::Layout layout;
 	layout.mouse = mouse;
 	layout.font = font;
 
-	CHECK(GetColorFromJson(root, "textColor", layout.textColor));
-	CHECK(GetColorFromJson(root, "disableColor", layout.disableColor));
-	CHECK(GetColorFromJson(root, "enableColor", layout.enableColor));
-	CHECK(GetColorFromJson(root, "pressColor", layout.pressColor));
-	CHECK(GetColorFromJson(root, "releaseColor", layout.releaseColor));
-	CHECK(GetVec2FromJson(root, "center", layout.center));
-	CHECK(GetVec2FromJson(root, "size", layout.size));
-	CHECK(GetWStringFromJson(root, "text", layout.text));
-	CHECK(GetFloatFromJson(root, "side", layout.side));
+	float* values[] =
+	{
+		layout.textColor.data,
+		layout.disableColor.data,
+		layout.enableColor.data,
+		layout.pressColor.data,
+		layout.releaseColor.data,
+		layout.center.data,
+		layout.size.data,
+		&layout.side,
+	};
+	LoadLayout(path, "button", values, layout.text);
 
 	return entityMgr_->Create<ButtonUI>(layout, clickEvent);
 }
 
 PanelUI* UIManager::CreatePanelUI(const std::string& path, TTFont* font)
 {
-	Json::Value root;
-	std::string message;
-	bool bSucceed = ReadJsonFile(path, root, message);
-	ASSERT(bSucceed, "%s", message.c_str());
-
-	std::string type;
-	CHECK(GetStringFromJson(root, "type", type) && type == "panel");
-
 	PanelUI::Layout layout;
 	layout.font = font;
 
-	CHECK(GetColorFromJson(root, "backgroundColor", layout.backgroundColor));
-	CHECK(GetColorFromJson(root, "outlineColor", layout.outlineColor));
-	CHECK(GetColorFromJson(root, "textColor", layout.textColor));
-	CHECK(GetVec2FromJson(root, "center", layout.center));
-	CHECK(GetVec2FromJson(root, "size", layout.size));
-	CHECK(GetWStringFromJson(root, "text", layout.text));
-	CHECK(GetFloatFromJson(root, "side", layout.side));
+	float* values[] =
+	{
+		layout.backgroundColor.data,
+		layout.outlineColor.data,
+		layout.textColor.data,
+		layout.center.data,
+		layout.size.data,
+		&layout.side,
+	};
+	LoadLayout(path, "panel", values, layout.text);
 
 	return entityMgr_->Create<PanelUI>(layout);
 }
 
 TextUI* UIManager::CreateTextUI(const std::string& path, TTFont* font)
+{
+	TextUI::Layout layout;
+	layout.font = font;
+
+	float* values[] =
+	{
+		layout.textColor.data,
+		layout.textCenterPos.data,
+	};
+	LoadLayout(path, "text", values, layout.text);
+
+	return entityMgr_->Create<TextUI>(layout);
+}
+
+void UIManager::CookLayout(const std::string& jsonPath, const std::string& outputPath)
 {
 	Json::Value root;
 	std::string message;
-	bool bSucceed = ReadJsonFile(path, root, message);
+	bool bSucceed = ReadJsonFile(jsonPath, root, message);
 	ASSERT(bSucceed, "%s", message.c_str());
 
 	std::string type;
-	CHECK(GetStringFromJson(root, "type", type) && type == "text");
+	CHECK(GetStringFromJson(root, "type", type));
 
-	TextUI::Layout layout;
-	layout.font = font;
+	auto it = LAYOUT_FIELDS.find(type);
+	ASSERT(it != LAYOUT_FIELDS.end() && type.size() < sizeof(CookedLayoutHeader::type), "Unknown layout type '%s' in '%s' file.", type.c_str(), jsonPath.c_str());
+
+	std::vector<float> values;
+	for (const auto& field : it->second)
+	{
+		std::size_t offset = values.size();
+		values.resize(offset + field.count);
+		CHECK(GetFieldFromJson(root, field, values.data() + offset));
+	}
 
-	CHECK(GetColorFromJson(root, "textColor", layout.textColor));
-	CHECK(GetVec2FromJson(root, "center", layout.textCenterPos));
-	CHECK(GetWStringFromJson(root, "text", layout.text));
+	CHECK(!root["text"].isNull() && root["text"].isString());
+	std::string text = root["text"].asString();
 
-	return entityMgr_->Create<TextUI>(layout);
+	CookedLayoutHeader header = {};
+	header.magic = COOKED_LAYOUT_MAGIC;
+	header.version = COOKED_LAYOUT_VERSION;
+	std::memcpy(header.type, type.c_str(), type.size());
+	header.valueCount = static_cast<uint32_t>(values.size());
+	header.textLength = static_cast<uint32_t>(text.size());
+
+	std::size_t valueOffset = sizeof(CookedLayoutHeader);
+	std::size_t textOffset = valueOffset + values.size() * sizeof(float);
+
+	std::vector<uint8_t> buffer(textOffset + text.size());
+	std::memcpy(buffer.data(), &header, sizeof(CookedLayoutHeader));
+	std::memcpy(buffer.data() + valueOffset, values.data(), values.size() * sizeof(float));
+	std::memcpy(buffer.data() + textOffset, text.data(), text.size());
+
+	GameUtils::WriteFile(outputPath, buffer);
 }
 
 void UIManager::BatchRenderUIEntity(IEntityUI** entities, uint32_t count)
@@ -279,21 +419,21 @@ void UIManager::PassString(IEntityUI** entities, uint32_t count)
 		case IEntityUI::Type::TEXT:
 		{
 			TextUI* text = reinterpret_cast<TextUI*>(entities[index]);
-			render2dMgr_->DrawString(text->layout_.font, text->layout_.text, text->textPos_, text->layout_.textColor);
+			render2dMgr_->DrawString(&text->textRun_, text->textPos_, text->layout_.textColor);
 		}
 		break;
 
 		case IEntityUI::Type::PANEL:
 		{
 			PanelUI* panel = reinterpret_cast<PanelUI*>(entities[index]);
-			render2dMgr_->DrawString(panel->layout_.font, panel->layout_.text, panel->textPos_, panel->layout_.textColor);
+			render2dMgr_->DrawString(&panel->textRun_, panel->textPos_, panel->layout_.textColor);
 		}
 		break;
 
 		case IEntityUI::Type::BUTTON:
 		{
 			ButtonUI* button = reinterpret_cast<ButtonUI*>(entities[index]);
-			render2dMgr_->DrawString(button->layout_.font, button->layout_.text, button->textPos_, button->layout_.textColor);
+			render2dMgr_->DrawString(&button->textRun_, button->textPos_, button->layout_.textColor);
 		}
 		break;
 		}
@@ -3,13 +3,23 @@
 #include "Assertion.h"
 #include "VertexBuffer.h"
 
+/**   ٸ ִ ð()Դϴ. */
+static const GLuint64 MAX_WAIT_SEGMENT_TIMEOUT = 1000000;
+
 VertexBuffer::VertexBuffer(uint32_t byteSize, const Usage& usage)
 	: byteSize_(byteSize)
 	, usage_(usage)
 {
 	GL_CHECK(glGenBuffers(1, &vertexBufferID_));
 	GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID_));
-	GL_CHECK(glBufferData(GL_ARRAY_BUFFER, byteSize_, nullptr, static_cast<GLenum>(usage)));
+	if (usage_ == Usage::PERSISTENT)
+	{
+		CreatePersistentStorage(nullptr);
+	}
+	else
+	{
+		GL_CHECK(glBufferData(GL_ARRAY_BUFFER, byteSize_, nullptr, static_cast<GLenum>(usage)));
+	}
 	GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
 
 	bIsInitialized_ = true;
@@ -21,7 +31,14 @@ VertexBuffer::VertexBuffer(const void* bufferPtr, uint32_t byteSize, const Usage
 {
 	GL_CHECK(glGenBuffers(1, &vertexBufferID_));
 	GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID_));
-	GL_CHECK(glBufferData(GL_ARRAY_BUFFER, byteSize_, bufferPtr, static_cast<GLenum>(usage)));
+	if (usage_ == Usage::PERSISTENT)
+	{
+		CreatePersistentStorage(bufferPtr);
+	}
+	else
+	{
+		GL_CHECK(glBufferData(GL_ARRAY_BUFFER, byteSize_, bufferPtr, static_cast<GLenum>(usage)));
+	}
 	GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
 
 	bIsInitialized_ = true;
@@ -39,6 +56,23 @@ void VertexBuffer::Release()
 {
 	CHECK(bIsInitialized_);
 
+	if (usage_ == Usage::PERSISTENT)
+	{
+		for (auto& fence : fences_)
+		{
+			if (fence)
+			{
+				GL_CHECK(glDeleteSync(reinterpret_cast<GLsync>(fence)));
+				fence = nullptr;
+			}
+		}
+
+		GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID_));
+		GL_CHECK(glUnmapBuffer(GL_ARRAY_BUFFER));
+		GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
+		mappedBufferPtr_ = nullptr;
+	}
+
 	GL_CHECK(glDeleteBuffers(1, &vertexBufferID_));
 
 	bIsInitialized_ = false;
@@ -58,6 +92,25 @@ void VertexBuffer::SetBufferData(const void* bufferPtr, uint32_t bufferSize)
 {
 	CHECK(bufferPtr != nullptr && bufferSize <= byteSize_);
 
+	if (usage_ == Usage::PERSISTENT) /**  ε ۴ ε      ٷ մϴ. */
+	{
+		if (segmentCursor_ + bufferSize > byteSize_)
+		{
+			Fence();
+		}
+
+		if (segmentCursor_ == 0) /**  ó   GPU   ´ Ȯմϴ. */
+		{
+			WaitSegment(segment_);
+		}
+
+		writeOffset_ = segment_ * byteSize_ + segmentCursor_;
+		segmentCursor_ += bufferSize;
+
+		std::memcpy(mappedBufferPtr_ + writeOffset_, bufferPtr, bufferSize);
+		return;
+	}
+
 	VertexBuffer::Bind();
 	{
 		void* vertexBufferPtr = nullptr;
@@ -83,4 +136,61 @@ void VertexBuffer::SetBufferData(const void* bufferPtr, uint32_t bufferSize)
 		}
 	}
 	VertexBuffer::Unbind();
+}
+
+void VertexBuffer::Fence()
+{
+	CHECK(usage_ == Usage::PERSISTENT);
+
+	if (segmentCursor_ == 0) /** ̹ ӿ    ״  ӿ մϴ. */
+	{
+		return;
+	}
+
+	if (fences_[segment_])
+	{
+		GL_CHECK(glDeleteSync(reinterpret_cast<GLsync>(fences_[segment_])));
+	}
+
+	fences_[segment_] = reinterpret_cast<void*>(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+	segment_ = (segment_ + 1) % MAX_RING_SEGMENT;
+	segmentCursor_ = 0;
+}
+
+void VertexBuffer::CreatePersistentStorage(const void* bufferPtr)
+{
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	GLsizeiptr storageSize = static_cast<GLsizeiptr>(byteSize_) * MAX_RING_SEGMENT;
+
+	GL_CHECK(glBufferStorage(GL_ARRAY_BUFFER, storageSize, nullptr, flags));
+	mappedBufferPtr_ = reinterpret_cast<uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, storageSize, flags));
+	ASSERT(mappedBufferPtr_ != nullptr, "Failed to map persistent vertex buffer.");
+
+	if (bufferPtr)
+	{
+		for (uint32_t segment = 0; segment < MAX_RING_SEGMENT; ++segment)
+		{
+			std::memcpy(mappedBufferPtr_ + segment * byteSize_, bufferPtr, byteSize_);
+		}
+	}
+}
+
+void VertexBuffer::WaitSegment(uint32_t segment)
+{
+	GLsync fence = reinterpret_cast<GLsync>(fences_[segment]);
+	if (!fence) /**  GPU    Դϴ. */
+	{
+		return;
+	}
+
+	/** Ʈ ۸ κ  ȯǸ, GPU   ̻ ó 쿡 մϴ. */
+	GLenum result = glClientWaitSync(fence, 0, 0);
+	while (result == GL_TIMEOUT_EXPIRED)
+	{
+		result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, MAX_WAIT_SEGMENT_TIMEOUT);
+	}
+	ASSERT(result != GL_WAIT_FAILED, "Failed to wait vertex buffer segment.");
+
+	GL_CHECK(glDeleteSync(fence));
+	fences_[segment] = nullptr;
 }
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "Assertion.h"
+#include "World.h"
+
+World::World()
+{
+	bIsInitialized_ = true;
+}
+
+World::~World()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void World::Tick(float deltaSeconds)
+{
+	for (auto& system : systems_)
+	{
+		system(*this, deltaSeconds);
+	}
+}
+
+void World::Render()
+{
+	for (auto& renderSystem : renderSystems_)
+	{
+		renderSystem(*this);
+	}
+}
+
+void World::Release()
+{
+	CHECK(bIsInitialized_);
+
+	systems_.clear();
+	renderSystems_.clear();
+
+	archetypeCache_.clear();
+	archetypes_.clear();
+
+	records_.clear();
+	freeIndex_ = EntityID::INVALID_INDEX;
+	entityCount_ = 0;
+
+	bIsInitialized_ = false;
+}
+
+void World::DestroyEntity(const EntityID& entityID)
+{
+	CHECK(queryDepth_ == 0);
+
+	if (!IsAlive(entityID))
+	{
+		return;
+	}
+
+	Record& record = records_[entityID.index];
+	EntityID movedEntityID = record.archetype->RemoveRow(record.row);
+	UpdateMovedRecord(movedEntityID, record.row);
+
+	record.archetype = nullptr;
+	record.row = 0;
+	record.generation++;
+	record.nextFreeIndex = freeIndex_;
+	freeIndex_ = entityID.index;
+	entityCount_--;
+}
+
+bool World::IsAlive(const EntityID& entityID) const
+{
+	return entityID.index < records_.size() && records_[entityID.index].generation == entityID.generation && records_[entityID.index].archetype != nullptr;
+}
+
+EntityID World::AllocateEntity()
+{
+	CHECK(queryDepth_ == 0);
+
+	uint32_t index = freeIndex_;
+	if (index != EntityID::INVALID_INDEX)
+	{
+		freeIndex_ = records_[index].nextFreeIndex;
+		records_[index].nextFreeIndex = EntityID::INVALID_INDEX;
+	}
+	else
+	{
+		index = static_cast<uint32_t>(records_.size());
+		records_.emplace_back();
+	}
+
+	entityCount_++;
+
+	EntityID entityID;
+	entityID.index = index;
+	entityID.generation = records_[index].generation;
+
+	return entityID;
+}
+
+Archetype* World::GetArchetype(ComponentMask mask)
+{
+	auto it = archetypeCache_.find(mask);
+	if (it != archetypeCache_.end())
+	{
+		return it->second;
+	}
+
+	archetypes_.push_back(std::make_unique<Archetype>(mask));
+
+	Archetype* archetype = archetypes_.back().get();
+	archetypeCache_.insert({ mask, archetype });
+
+	return archetype;
+}
+
+bool World::MoveEntity(const EntityID& entityID, uint32_t componentID, bool bIsAdd)
+{
+	CHECK(queryDepth_ == 0);
+
+	if (!IsAlive(entityID))
+	{
+		return false;
+	}
+
+	Record& record = records_[entityID.index];
+	Archetype* src = record.archetype;
+
+	Archetype*& edge = bIsAdd ? src->GetAddEdge(componentID) : src->GetRemoveEdge(componentID);
+	if (!edge)
+	{
+		ComponentMask bit = static_cast<ComponentMask>(1) << componentID;
+		edge = GetArchetype(bIsAdd ? (src->GetMask() | bit) : (src->GetMask() & ~bit));
+	}
+
+	Archetype* dst = edge;
+	uint32_t srcRow = record.row;
+	uint32_t dstRow = 0;
+
+	EntityID movedEntityID = src->MoveRow(srcRow, dst, dstRow);
+	UpdateMovedRecord(movedEntityID, srcRow);
+
+	record.archetype = dst;
+	record.row = dstRow;
+
+	return true;
+}
+
+void World::UpdateMovedRecord(const EntityID& movedEntityID, uint32_t row)
+{
+	if (!movedEntityID.IsNull())
+	{
+		records_[movedEntityID.index].row = row;
+	}
+}
\ No newline at end of file
@@ -6,9 +6,10 @@ layout(location = 2) in vec4 inColor;
 layout(location = 0) out vec4 outColor;
 
 uniform mat4 ortho;
+uniform mat4 world = mat4(1.0f); /** Transform of StaticBatch2D. Identity for immediate draws. */
 
 void main()
 {
-	gl_Position = ortho * vec4(vec3(inPosition, 0.0f), 1.0f);
+	gl_Position = ortho * world * vec4(vec3(inPosition, 0.0f), 1.0f);
 	outColor = inColor;
 }
\ No newline at end of file
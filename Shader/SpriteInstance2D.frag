@@ -0,0 +1,16 @@
+#version 460 core
+
+layout(location = 0) in vec2 inTexCoords;
+layout(location = 1) in vec4 inColor;
+layout(location = 2) in float inTransparent;
+
+layout(location = 0) out vec4 outFragColor;
+
+layout(binding = 0) uniform sampler2D sprite;
+
+void main()
+{
+	vec4 color = texture(sprite, inTexCoords);
+	vec3 fragColor = mix(color.rgb, inColor.rgb, inColor.a); /** Color Blending. */
+	outFragColor = vec4(fragColor, color.a * inTransparent);
+}
\ No newline at end of file
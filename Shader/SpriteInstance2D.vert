@@ -0,0 +1,41 @@
+#version 460 core
+
+layout(location = 0) in vec2 inCenter;
+layout(location = 1) in vec2 inSize;
+layout(location = 2) in vec2 inRotateTransparent;
+layout(location = 3) in vec4 inTexRect;
+layout(location = 4) in vec4 inBlend;
+
+layout(location = 0) out vec2 outTexCoords;
+layout(location = 1) out vec4 outColor;
+layout(location = 2) out float outTransparent;
+
+uniform mat4 ortho;
+
+const float TWO_PI = 6.283185307f;
+const vec2 PIXEL_OFFSET = vec2(0.375f, 0.375f);
+
+/** GL_TRIANGLE_STRIP order: bottom-left, bottom-right, top-left, top-right. */
+const vec2 CORNERS[4] = vec2[4](
+	vec2(-0.5f, -0.5f),
+	vec2(+0.5f, -0.5f),
+	vec2(-0.5f, +0.5f),
+	vec2(+0.5f, +0.5f)
+);
+
+void main()
+{
+	vec2 corner = CORNERS[gl_VertexID];
+	vec2 position = corner * inSize;
+
+	float rotate = inRotateTransparent.x * TWO_PI;
+	float c = cos(rotate);
+	float s = sin(rotate);
+	position = vec2(c * position.x - s * position.y, s * position.x + c * position.y);
+	position += inCenter + PIXEL_OFFSET;
+
+	gl_Position = ortho * vec4(vec3(position, 0.0f), 1.0f);
+	outTexCoords = vec2(corner.x < 0.0f ? inTexRect.x : inTexRect.z, corner.y < 0.0f ? inTexRect.w : inTexRect.y);
+	outColor = inBlend;
+	outTransparent = inRotateTransparent.y;
+}
\ No newline at end of file
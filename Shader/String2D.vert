@@ -10,10 +10,11 @@ layout(location = 1) out vec4 outColor;
 layout(location = 2) out int outUnit;
 
 uniform mat4 ortho;
+uniform mat4 world = mat4(1.0f); /** Transform of StaticBatch2D. Identity for immediate draws. */
 
 void main()
 {
-	gl_Position = ortho * vec4(vec3(inPosition, 0.0f), 1.0f);
+	gl_Position = ortho * world * vec4(vec3(inPosition, 0.0f), 1.0f);
 	outTexCoords = inTexCoords;
 	outColor = inColor;
 	outUnit = inUnit;
@@ -0,0 +1,43 @@
+#include <cstdio>
+#include <string>
+
+#include "Atlas2D.h"
+#include "TextureFileCheck.h"
+#include "UIManager.h"
+
+/**
+ * JSON  Ÿӿ Ľ     ִ ̳ʸ(.cooked) ŷϴ Դϴ.
+ *
+ * :
+ * MiniGameCook atlas [̹ ] [JSON ] [ ]
+ * MiniGameCook ui [JSON ] [ ]
+ * MiniGameCook texcheck (޸𸮿  DDS/KTX2  ؽó  ļ ˻մϴ)
+ */
+int main(int argc, char* argv[])
+{
+	std::string mode = (argc > 1) ? argv[1] : "";
+
+	if (mode == "texcheck" && argc == 2)
+	{
+		return (RunTextureFileCheck() == 0) ? 0 : 1;
+	}
+
+	if (mode == "atlas" && argc == 5)
+	{
+		Atlas2D::Cook(argv[2], argv[3], argv[4]);
+	}
+	else if (mode == "ui" && argc == 4)
+	{
+		UIManager::CookLayout(argv[2], argv[3]);
+	}
+	else
+	{
+		std::printf("Usage: MiniGameCook atlas <image> <json> <output>\n");
+		std::printf("       MiniGameCook ui <json> <output>\n");
+		std::printf("       MiniGameCook texcheck\n");
+		return 1;
+	}
+
+	std::printf("Cooked '%s'.\n", argv[argc - 1]);
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "TextureFile.h"
+#include "TextureFileCheck.h"
+
+static const std::size_t DDS_HEADER_SIZE = 128;
+static const std::size_t DDS_HEADER_DX10_SIZE = 20;
+static const std::size_t KTX2_HEADER_SIZE = 80;
+static const std::size_t KTX2_LEVEL_INDEX_SIZE = 24;
+
+static const uint32_t FOURCC_DXT1 = 0x31545844;
+static const uint32_t FOURCC_DX10 = 0x30315844;
+static const uint32_t DXGI_FORMAT_R8G8B8A8_UNORM = 28;
+static const uint32_t VK_FORMAT_R8G8B8A8_UNORM = 37;
+
+static int32_t failCount = 0;
+
+static void Check(bool bIsPassed, const char* name)
+{
+	std::printf("[%s] %s\n", bIsPassed ? "PASS" : "FAIL", name);
+	failCount += bIsPassed ? 0 : 1;
+}
+
+static void Write32(std::vector<uint8_t>& buffer, std::size_t offset, uint32_t value)
+{
+	std::memcpy(buffer.data() + offset, &value, sizeof(uint32_t));
+}
+
+static void Write64(std::vector<uint8_t>& buffer, std::size_t offset, uint64_t value)
+{
+	std::memcpy(buffer.data() + offset, &value, sizeof(uint64_t));
+}
+
+static bool Parse(const std::vector<uint8_t>& buffer, bool bIsDDS, TextureFile::Desc& outDesc)
+{
+	std::string result;
+	if (bIsDDS)
+	{
+		return TextureFile::ParseDDS(buffer.data(), buffer.size(), outDesc, result);
+	}
+
+	return TextureFile::ParseKTX2(buffer.data(), buffer.size(), outDesc, result);
+}
+
+/** DXT1(fourCC) Ǵ DX10      DDS  ϴ. dataSize   Ʈ Դϴ. */
+static std::vector<uint8_t> MakeDDS(uint32_t width, uint32_t height, uint32_t mipCount, bool bIsDX10, std::size_t dataSize)
+{
+	std::size_t headerSize = DDS_HEADER_SIZE + (bIsDX10 ? DDS_HEADER_DX10_SIZE : 0);
+	std::vector<uint8_t> buffer(headerSize + dataSize, 0);
+
+	Write32(buffer, 0, 0x20534444); /** "DDS " */
+	Write32(buffer, 4, 124);
+	Write32(buffer, 8, 0x00021007); /** CAPS | HEIGHT | WIDTH | PIXELFORMAT | MIPMAPCOUNT */
+	Write32(buffer, 12, height);
+	Write32(buffer, 16, width);
+	Write32(buffer, 28, mipCount);
+	Write32(buffer, 76, 32);
+	Write32(buffer, 80, 0x00000004); /** DDPF_FOURCC */
+	Write32(buffer, 84, bIsDX10 ? FOURCC_DX10 : FOURCC_DXT1);
+
+	if (bIsDX10)
+	{
+		Write32(buffer, DDS_HEADER_SIZE + 0, DXGI_FORMAT_R8G8B8A8_UNORM);
+		Write32(buffer, DDS_HEADER_SIZE + 4, 3); /** DDS_DIMENSION_TEXTURE2D */
+		Write32(buffer, DDS_HEADER_SIZE + 12, 1);
+	}
+
+	return buffer;
+}
+
+/** RGBA8 KTX2  ϴ.  ʹ  ε ٷ ڿ ū Ӻ ٿ ġմϴ. */
+static std::vector<uint8_t> MakeKTX2(uint32_t width, uint32_t height, uint32_t levelCount)
+{
+	static const uint8_t IDENTIFIER[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+	uint32_t indexCount = (levelCount == 0) ? 1 : levelCount;
+	std::size_t offset = KTX2_HEADER_SIZE + indexCount * KTX2_LEVEL_INDEX_SIZE;
+
+	std::vector<uint8_t> buffer(offset, 0);
+	std::memcpy(buffer.data(), IDENTIFIER, sizeof(IDENTIFIER));
+	Write32(buffer, 12, VK_FORMAT_R8G8B8A8_UNORM);
+	Write32(buffer, 16, 1);
+	Write32(buffer, 20, width);
+	Write32(buffer, 24, height);
+	Write32(buffer, 36, 1);
+	Write32(buffer, 40, levelCount);
+
+	for (uint32_t level = 0; level < indexCount; ++level)
+	{
+		uint32_t levelWidth = (width >> level) > 0 ? (width >> level) : 1;
+		uint32_t levelHeight = (height >> level) > 0 ? (height >> level) : 1;
+		uint64_t levelSize = static_cast<uint64_t>(levelWidth) * static_cast<uint64_t>(levelHeight) * 4;
+
+		std::size_t indexOffset = KTX2_HEADER_SIZE + level * KTX2_LEVEL_INDEX_SIZE;
+		Write64(buffer, indexOffset + 0, buffer.size());
+		Write64(buffer, indexOffset + 8, levelSize);
+		Write64(buffer, indexOffset + 16, levelSize);
+
+		buffer.resize(buffer.size() + static_cast<std::size_t>(levelSize), 0);
+	}
+
+	return buffer;
+}
+
+static void CheckLevelSize()
+{
+	TextureFile::Format dxt1;
+	dxt1.bIsCompressed = true;
+	dxt1.blockSize = 8;
+
+	TextureFile::Format bc3;
+	bc3.bIsCompressed = true;
+	bc3.blockSize = 16;
+
+	TextureFile::Format rgba8;
+	rgba8.bIsCompressed = false;
+	rgba8.blockSize = 4;
+
+	Check(TextureFile::GetLevelSize(dxt1, 1, 1) == 8, "GetLevelSize: DXT1 1x1 uses one block");
+	Check(TextureFile::GetLevelSize(dxt1, 5, 5) == 32, "GetLevelSize: DXT1 5x5 rounds up to 2x2 blocks");
+	Check(TextureFile::GetLevelSize(dxt1, 64, 64) == 2048, "GetLevelSize: DXT1 64x64");
+	Check(TextureFile::GetLevelSize(bc3, 5, 5) == 64, "GetLevelSize: BC3 5x5");
+	Check(TextureFile::GetLevelSize(rgba8, 3, 2) == 24, "GetLevelSize: RGBA8 3x2");
+
+	if (sizeof(std::size_t) == sizeof(uint64_t))
+	{
+		Check(TextureFile::GetLevelSize(dxt1, 0xFFFFFFFF, 4) == 1073741824ULL * 8ULL, "GetLevelSize: block count of max width does not wrap");
+	}
+}
+
+static void CheckDDS()
+{
+	TextureFile::Desc desc;
+
+	/** 64x64 DXT1 ü  ü 2048 + 512 + 128 + 32 + 8 + 8 + 8 ƮԴϴ. */
+	std::vector<uint8_t> dds = MakeDDS(64, 64, 7, false, 2744);
+	bool bIsParsed = Parse(dds, true, desc);
+	Check(bIsParsed && desc.levelCount == 7 && desc.format.bIsCompressed && desc.format.blockSize == 8, "ParseDDS: DXT1 64x64 with full mip chain");
+	Check(bIsParsed && desc.levels[0].offset == DDS_HEADER_SIZE && desc.levels[0].size == 2048, "ParseDDS: first level follows the header");
+	Check(bIsParsed && desc.levels[6].offset == DDS_HEADER_SIZE + 2736 && desc.levels[6].size == 8, "ParseDDS: last level offset");
+
+	dds = MakeDDS(64, 64, 20, false, 2744);
+	Check(Parse(dds, true, desc) && desc.levelCount == 7, "ParseDDS: mip count is clamped to the full chain");
+
+	dds = MakeDDS(64, 64, 7, false, 2743);
+	Check(!Parse(dds, true, desc), "ParseDDS: rejects a truncated last level");
+
+	dds = MakeDDS(64, 64, 1, false, 0);
+	dds.resize(DDS_HEADER_SIZE - 1);
+	Check(!Parse(dds, true, desc), "ParseDDS: rejects a truncated header");
+
+	dds = MakeDDS(64, 64, 1, false, 2048);
+	Write32(dds, 0, 0);
+	Check(!Parse(dds, true, desc), "ParseDDS: rejects a bad magic");
+
+	dds = MakeDDS(4, 4, 1, true, 64);
+	bIsParsed = Parse(dds, true, desc);
+	Check(bIsParsed && !desc.format.bIsCompressed && desc.levels[0].offset == DDS_HEADER_SIZE + DDS_HEADER_DX10_SIZE && desc.levels[0].size == 64, "ParseDDS: DX10 RGBA8 level follows the DX10 header");
+
+	dds = MakeDDS(4, 4, 1, true, 0);
+	dds.resize(DDS_HEADER_SIZE + DDS_HEADER_DX10_SIZE - 1);
+	Check(!Parse(dds, true, desc), "ParseDDS: rejects a truncated DX10 header");
+}
+
+static void CheckKTX2()
+{
+	TextureFile::Desc desc;
+
+	std::vector<uint8_t> ktx2 = MakeKTX2(4, 4, 3);
+	bool bIsParsed = Parse(ktx2, false, desc);
+	std::size_t dataOffset = KTX2_HEADER_SIZE + 3 * KTX2_LEVEL_INDEX_SIZE;
+	Check(bIsParsed && desc.levelCount == 3 && !desc.bGenerateMipmap, "ParseKTX2: RGBA8 4x4 with full mip chain");
+	Check(bIsParsed && desc.levels[0].offset == dataOffset && desc.levels[0].size == 64, "ParseKTX2: first level offset and size");
+	Check(bIsParsed && desc.levels[2].offset == dataOffset + 80 && desc.levels[2].size == 4, "ParseKTX2: last level offset and size");
+
+	ktx2 = MakeKTX2(4, 4, 0);
+	Check(Parse(ktx2, false, desc) && desc.levelCount == 1 && desc.bGenerateMipmap, "ParseKTX2: level count 0 requests runtime mipmaps");
+
+	ktx2 = MakeKTX2(4, 4, 3);
+	Write64(ktx2, KTX2_HEADER_SIZE, 0xFFFFFFFFFFFFFFF0ULL);
+	Check(!Parse(ktx2, false, desc), "ParseKTX2: rejects a byte offset that wraps when added to the level size");
+
+	ktx2 = MakeKTX2(4, 4, 3);
+	Write64(ktx2, KTX2_HEADER_SIZE, ktx2.size());
+	Check(!Parse(ktx2, false, desc), "ParseKTX2: rejects a level that starts at the end of the file");
+
+	ktx2 = MakeKTX2(4, 4, 3);
+	Write64(ktx2, KTX2_HEADER_SIZE + 8, 63);
+	Check(!Parse(ktx2, false, desc), "ParseKTX2: rejects a byte length smaller than the level size");
+
+	ktx2 = MakeKTX2(4, 4, 3);
+	ktx2.pop_back();
+	Check(!Parse(ktx2, false, desc), "ParseKTX2: rejects a truncated last level");
+
+	ktx2 = MakeKTX2(4, 4, 3);
+	Write32(ktx2, 40, 5);
+	Check(!Parse(ktx2, false, desc), "ParseKTX2: rejects more levels than the full chain");
+
+	ktx2 = MakeKTX2(4, 4, 3);
+	ktx2.resize(KTX2_HEADER_SIZE + KTX2_LEVEL_INDEX_SIZE);
+	Check(!Parse(ktx2, false, desc), "ParseKTX2: rejects a truncated level index");
+
+	ktx2 = MakeKTX2(4, 4, 1);
+	ktx2[0] = 0;
+	Check(!Parse(ktx2, false, desc), "ParseKTX2: rejects a bad identifier");
+}
+
+int RunTextureFileCheck()
+{
+	failCount = 0;
+
+	CheckLevelSize();
+	CheckDDS();
+	CheckKTX2();
+
+	std::printf("%d check(s) failed.\n", failCount);
+	return failCount;
+}
\ No newline at end of file
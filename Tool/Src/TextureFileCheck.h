@@ -0,0 +1,8 @@
+#pragma once
+
+/**
+ * ޸𸮿  DDS/KTX2  TextureFile ParseDDS, ParseKTX2, GetLevelSize ˻մϴ.
+ * ̳ GL ؽƮ ʿ Ƿ 帮 ȯ濡   ֽϴ.
+ *  ˻  ȯմϴ.
+ */
+int RunTextureFileCheck();
\ No newline at end of file